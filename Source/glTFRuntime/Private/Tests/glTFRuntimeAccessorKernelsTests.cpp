@@ -0,0 +1,379 @@
+// Copyright 2020-2022, Roberto De Ioris.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "glTFRuntimeAccessorKernels.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/*
+ * The kernels are compared against a copy of the original per-element BuildFromAccessorField loop
+ * (and of the per-element SceneBasis lambdas for the transformed attributes).
+ */
+namespace glTFRuntimeAccessorKernelsTests
+{
+	template<typename T>
+	struct TReferenceStore
+	{
+		static void Set(T& Value, const int32 Index, const float Component)
+		{
+			Value[Index] = Component;
+		}
+	};
+
+	template<>
+	struct TReferenceStore<float>
+	{
+		static void Set(float& Value, const int32 Index, const float Component)
+		{
+			Value = Component;
+		}
+	};
+
+	template<typename SourceType>
+	SourceType Read(const uint8* Ptr, const int32 Index)
+	{
+		SourceType Value;
+		FMemory::Memcpy(&Value, Ptr + Index * sizeof(SourceType), sizeof(SourceType));
+		return Value;
+	}
+
+	template<typename T>
+	bool ReferenceDecode(const int64 ComponentType, const bool bNormalized, const int64 Elements, const uint8* Source, const int64 Stride, const int64 Count, TArray<T>& Data)
+	{
+		for (int64 ElementIndex = 0; ElementIndex < Count; ElementIndex++)
+		{
+			const uint8* Ptr = Source + ElementIndex * Stride;
+			T Value;
+			for (int32 i = 0; i < Elements; i++)
+			{
+				// FLOAT
+				if (ComponentType == 5126)
+				{
+					TReferenceStore<T>::Set(Value, i, Read<float>(Ptr, i));
+				}
+				// BYTE
+				else if (ComponentType == 5120)
+				{
+					const int8 Component = Read<int8>(Ptr, i);
+					TReferenceStore<T>::Set(Value, i, bNormalized ? FMath::Max(((float)Component) / 127.f, -1.f) : Component);
+				}
+				// UNSIGNED_BYTE
+				else if (ComponentType == 5121)
+				{
+					const uint8 Component = Read<uint8>(Ptr, i);
+					TReferenceStore<T>::Set(Value, i, bNormalized ? ((float)Component) / 255.f : Component);
+				}
+				// SHORT
+				else if (ComponentType == 5122)
+				{
+					const int16 Component = Read<int16>(Ptr, i);
+					TReferenceStore<T>::Set(Value, i, bNormalized ? FMath::Max(((float)Component) / 32767.f, -1.f) : Component);
+				}
+				// UNSIGNED_SHORT
+				else if (ComponentType == 5123)
+				{
+					const uint16 Component = Read<uint16>(Ptr, i);
+					TReferenceStore<T>::Set(Value, i, bNormalized ? ((float)Component) / 65535.f : Component);
+				}
+				else
+				{
+					return false;
+				}
+			}
+			Data.Add(Value);
+		}
+		return true;
+	}
+
+	int64 GetComponentSize(const int64 ComponentType)
+	{
+		switch (ComponentType)
+		{
+		case 5120:
+		case 5121:
+			return 1;
+		case 5122:
+		case 5123:
+			return 2;
+		default:
+			break;
+		}
+		return 4;
+	}
+
+	// random components (floats are kept finite), Padding bytes are added before the first element to break alignment
+	void FillAccessor(FRandomStream& RandomStream, const int64 ComponentType, const int64 Elements, const int64 Stride, const int64 Count, const int32 Padding, TArray64<uint8>& Bytes)
+	{
+		Bytes.SetNumUninitialized(Padding + Stride * Count);
+		for (int64 ByteIndex = 0; ByteIndex < Bytes.Num(); ByteIndex++)
+		{
+			Bytes[ByteIndex] = (uint8)RandomStream.RandRange(0, 255);
+		}
+
+		if (ComponentType == 5126)
+		{
+			for (int64 ElementIndex = 0; ElementIndex < Count; ElementIndex++)
+			{
+				for (int64 ComponentIndex = 0; ComponentIndex < Elements; ComponentIndex++)
+				{
+					const float Value = RandomStream.FRandRange(-1000.f, 1000.f);
+					FMemory::Memcpy(Bytes.GetData() + Padding + ElementIndex * Stride + ComponentIndex * sizeof(float), &Value, sizeof(float));
+				}
+			}
+		}
+	}
+
+	template<typename T>
+	T TransformReference(const T& Value, const FMatrix& Matrix, const float Scale, const bool bTranslate);
+
+	template<>
+	FVector TransformReference<FVector>(const FVector& Value, const FMatrix& Matrix, const float Scale, const bool bTranslate)
+	{
+		return bTranslate ? Matrix.TransformPosition(Value) * Scale : Matrix.TransformVector(Value) * Scale;
+	}
+
+	template<>
+	FVector4 TransformReference<FVector4>(const FVector4& Value, const FMatrix& Matrix, const float Scale, const bool bTranslate)
+	{
+		return Matrix.TransformFVector4(Value);
+	}
+
+	// transformed values are bit exact with single precision matrices, UE5 matrices are evaluated in double precision
+	template<typename T>
+	bool CompareTransformed(const T& Value, const T& Expected, const int32 Elements)
+	{
+		for (int32 ComponentIndex = 0; ComponentIndex < Elements; ComponentIndex++)
+		{
+#if ENGINE_MAJOR_VERSION > 4
+			if (!FMath::IsNearlyEqual(Value[ComponentIndex], Expected[ComponentIndex], FMath::Max(1.0, FMath::Abs(Expected[ComponentIndex])) * 1e-5))
+#else
+			if (Value[ComponentIndex] != Expected[ComponentIndex])
+#endif
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAccessorKernelsDecodeTest, "glTFRuntime.AccessorKernels.Decode", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FglTFRuntimeAccessorKernelsDecodeTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeAccessorKernelsTests;
+
+	FRandomStream RandomStream(17);
+
+	const int64 ComponentTypes[] = { 5120, 5121, 5122, 5123, 5126 };
+	// less than a SIMD lane, not a multiple of 4, more than a batch
+	const int64 Counts[] = { 1, 7, 300, 1031 };
+
+	for (const int64 ComponentType : ComponentTypes)
+	{
+		for (int32 NormalizedIndex = 0; NormalizedIndex < 2; NormalizedIndex++)
+		{
+			const bool bNormalized = NormalizedIndex == 1;
+			if (bNormalized && ComponentType == 5126)
+			{
+				continue;
+			}
+
+			for (int64 Elements = 1; Elements <= 4; Elements++)
+			{
+				const int64 PackedSize = GetComponentSize(ComponentType) * Elements;
+				// packed, aligned to 4 bytes (as required by glTF for vertex attributes) and interleaved
+				const int64 Strides[] = { PackedSize, Align(PackedSize, 4), Align(PackedSize, 4) + 12 };
+				for (const int64 Stride : Strides)
+				{
+					for (const int64 Count : Counts)
+					{
+						for (int32 Padding = 0; Padding < 2; Padding++)
+						{
+							TArray64<uint8> Bytes;
+							FillAccessor(RandomStream, ComponentType, Elements, Stride, Count, Padding, Bytes);
+							const uint8* Source = Bytes.GetData() + Padding;
+
+							const FString Context = FString::Printf(TEXT("componentType %lld normalized %d elements %lld stride %lld count %lld padding %d"), ComponentType, bNormalized ? 1 : 0, Elements, Stride, Count, Padding);
+
+							bool bDecoded = false;
+							bool bSame = false;
+							if (Elements == 1)
+							{
+								TArray<float> Expected;
+								TArray<float> Decoded;
+								Decoded.SetNumUninitialized(Count);
+								ReferenceDecode(ComponentType, bNormalized, Elements, Source, Stride, Count, Expected);
+								bDecoded = FglTFRuntimeAccessorKernels::Decode(ComponentType, bNormalized, Elements, Source, Stride, Count, Decoded.GetData());
+								bSame = FMemory::Memcmp(Expected.GetData(), Decoded.GetData(), Count * sizeof(float)) == 0;
+							}
+							else if (Elements == 2)
+							{
+								TArray<FVector2D> Expected;
+								TArray<FVector2D> Decoded;
+								Decoded.SetNumUninitialized(Count);
+								ReferenceDecode(ComponentType, bNormalized, Elements, Source, Stride, Count, Expected);
+								bDecoded = FglTFRuntimeAccessorKernels::Decode(ComponentType, bNormalized, Elements, Source, Stride, Count, Decoded.GetData());
+								bSame = FMemory::Memcmp(Expected.GetData(), Decoded.GetData(), Count * sizeof(FVector2D)) == 0;
+							}
+							else if (Elements == 3)
+							{
+								TArray<FVector> Expected;
+								TArray<FVector> Decoded;
+								Decoded.SetNumUninitialized(Count);
+								ReferenceDecode(ComponentType, bNormalized, Elements, Source, Stride, Count, Expected);
+								bDecoded = FglTFRuntimeAccessorKernels::Decode(ComponentType, bNormalized, Elements, Source, Stride, Count, Decoded.GetData());
+								bSame = FMemory::Memcmp(Expected.GetData(), Decoded.GetData(), Count * sizeof(FVector)) == 0;
+							}
+							else
+							{
+								TArray<FVector4> Expected;
+								TArray<FVector4> Decoded;
+								Decoded.SetNumUninitialized(Count);
+								ReferenceDecode(ComponentType, bNormalized, Elements, Source, Stride, Count, Expected);
+								bDecoded = FglTFRuntimeAccessorKernels::Decode(ComponentType, bNormalized, Elements, Source, Stride, Count, Decoded.GetData());
+								bSame = FMemory::Memcmp(Expected.GetData(), Decoded.GetData(), Count * sizeof(FVector4)) == 0;
+							}
+
+							TestTrue(FString::Printf(TEXT("Decode (%s)"), *Context), bDecoded);
+							TestTrue(FString::Printf(TEXT("Decoded values match the reference (%s)"), *Context), bSame);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAccessorKernelsTransformTest, "glTFRuntime.AccessorKernels.Transform", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FglTFRuntimeAccessorKernelsTransformTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeAccessorKernelsTests;
+
+	FRandomStream RandomStream(23);
+
+	// the default glTF to UE basis (reduced to a swizzle) and a generic rotation + translation (full row transform)
+	const FMatrix SwizzleMatrix = FBasisVectorMatrix(FVector(0, 0, -1), FVector(1, 0, 0), FVector(0, 1, 0), FVector::ZeroVector);
+	const FMatrix GenericMatrix = FRotationTranslationMatrix(FRotator(30, 45, -60), FVector(10, -20, 30));
+
+	const int64 ComponentTypes[] = { 5120, 5122, 5126 };
+
+	for (int32 MatrixIndex = 0; MatrixIndex < 2; MatrixIndex++)
+	{
+		const bool bSwizzle = MatrixIndex == 0;
+		const FMatrix& Matrix = bSwizzle ? SwizzleMatrix : GenericMatrix;
+		const FglTFRuntimeAccessorTransform PositionTransform(Matrix, 100, true);
+		const FglTFRuntimeAccessorTransform VectorTransform(Matrix, 1, false);
+
+		TestEqual(TEXT("Swizzle detection"), PositionTransform.bSwizzle, bSwizzle);
+
+		for (const int64 ComponentType : ComponentTypes)
+		{
+			const bool bNormalized = ComponentType != 5126;
+			const int64 ComponentSize = GetComponentSize(ComponentType);
+			const int64 Count = 300;
+
+			for (int32 Padding = 0; Padding < 2; Padding++)
+			{
+				const FString Context = FString::Printf(TEXT("componentType %lld swizzle %d padding %d"), ComponentType, bSwizzle ? 1 : 0, Padding);
+
+				// POSITION/NORMAL (float3, interleaved)
+				{
+					const int64 Stride = Align(ComponentSize * 3, 4) + 8;
+					TArray64<uint8> Bytes;
+					FillAccessor(RandomStream, ComponentType, 3, Stride, Count, Padding, Bytes);
+					const uint8* Source = Bytes.GetData() + Padding;
+
+					TArray<FVector> Values;
+					ReferenceDecode(ComponentType, bNormalized, 3, Source, Stride, Count, Values);
+
+					for (const bool bTranslate : { true, false })
+					{
+						const FglTFRuntimeAccessorTransform& Transform = bTranslate ? PositionTransform : VectorTransform;
+						TArray<FVector> Decoded;
+						Decoded.SetNumUninitialized(Count);
+						TestTrue(FString::Printf(TEXT("Decode float3 (%s)"), *Context), FglTFRuntimeAccessorKernels::Decode(ComponentType, bNormalized, 3, Source, Stride, Count, Decoded.GetData(), &Transform));
+
+						bool bSame = true;
+						for (int64 Index = 0; Index < Count && bSame; Index++)
+						{
+							bSame = CompareTransformed(Decoded[Index], TransformReference(Values[Index], Matrix, bTranslate ? 100.f : 1.f, bTranslate), 3);
+						}
+						TestTrue(FString::Printf(TEXT("Transformed float3 match the reference (%s translate %d)"), *Context, bTranslate ? 1 : 0), bSame);
+					}
+				}
+
+				// TANGENT (float4)
+				{
+					const int64 Stride = ComponentSize * 4;
+					TArray64<uint8> Bytes;
+					FillAccessor(RandomStream, ComponentType, 4, Stride, Count, Padding, Bytes);
+					const uint8* Source = Bytes.GetData() + Padding;
+
+					TArray<FVector4> Values;
+					ReferenceDecode(ComponentType, bNormalized, 4, Source, Stride, Count, Values);
+
+					TArray<FVector4> Decoded;
+					Decoded.SetNumUninitialized(Count);
+					TestTrue(FString::Printf(TEXT("Decode float4 (%s)"), *Context), FglTFRuntimeAccessorKernels::Decode(ComponentType, bNormalized, 4, Source, Stride, Count, Decoded.GetData(), &VectorTransform));
+
+					bool bSame = true;
+					for (int64 Index = 0; Index < Count && bSame; Index++)
+					{
+						bSame = CompareTransformed(Decoded[Index], TransformReference(Values[Index], Matrix, 1.f, false), 4);
+					}
+					TestTrue(FString::Printf(TEXT("Transformed float4 match the reference (%s)"), *Context), bSame);
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAccessorKernelsIndicesTest, "glTFRuntime.AccessorKernels.Indices", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FglTFRuntimeAccessorKernelsIndicesTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeAccessorKernelsTests;
+
+	FRandomStream RandomStream(29);
+
+	const int64 ComponentTypes[] = { 5121, 5123, 5125 };
+	const int64 Count = 1031;
+
+	for (const int64 ComponentType : ComponentTypes)
+	{
+		const int64 ComponentSize = ComponentType == 5125 ? 4 : GetComponentSize(ComponentType);
+		for (const int64 Stride : { ComponentSize, ComponentSize + 2 })
+		{
+			for (int32 Padding = 0; Padding < 2; Padding++)
+			{
+				TArray64<uint8> Bytes;
+				FillAccessor(RandomStream, ComponentType, 1, Stride, Count, Padding, Bytes);
+				const uint8* Source = Bytes.GetData() + Padding;
+
+				TArray<uint32> Decoded;
+				Decoded.SetNumUninitialized(Count);
+				TestTrue(TEXT("DecodeIndices"), FglTFRuntimeAccessorKernels::DecodeIndices(ComponentType, Source, Stride, Count, Decoded.GetData()));
+
+				bool bSame = true;
+				for (int64 Index = 0; Index < Count && bSame; Index++)
+				{
+					const uint8* Ptr = Source + Index * Stride;
+					const uint32 Expected = ComponentType == 5121 ? Read<uint8>(Ptr, 0) : (ComponentType == 5123 ? Read<uint16>(Ptr, 0) : Read<uint32>(Ptr, 0));
+					bSame = Decoded[Index] == Expected;
+				}
+				TestTrue(FString::Printf(TEXT("Indices match the reference (componentType %lld stride %lld padding %d)"), ComponentType, Stride, Padding), bSame);
+			}
+		}
+	}
+
+	return true;
+}
+
+#endif
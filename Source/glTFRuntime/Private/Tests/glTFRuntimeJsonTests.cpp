@@ -0,0 +1,241 @@
+// Copyright 2020-2022, Roberto De Ioris.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "glTFRuntimeParser.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/*
+ * The UTF-8 reader is compared against TJsonReader<TCHAR> (the FString backend) on the same documents,
+ * both have to build the same DOM (object keys, value types, strings and doubles bit exact).
+ */
+namespace glTFRuntimeJsonTests
+{
+	TSharedPtr<FJsonValue> ParseUTF8(const ANSICHAR* Json, int64& ErrorOffset)
+	{
+		return FglTFRuntimeParser::ParseUTF8Json(reinterpret_cast<const uint8*>(Json), FCStringAnsi::Strlen(Json), ErrorOffset);
+	}
+
+	TSharedPtr<FJsonValue> ParseReference(const ANSICHAR* Json)
+	{
+		const FString JsonString = UTF8_TO_TCHAR(Json);
+		TSharedPtr<FJsonValue> Value;
+		TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create(JsonString);
+		if (!FJsonSerializer::Deserialize(Reader, Value))
+		{
+			return nullptr;
+		}
+		return Value;
+	}
+
+	bool SameJson(const TSharedPtr<FJsonValue>& A, const TSharedPtr<FJsonValue>& B)
+	{
+		if (!A.IsValid() || !B.IsValid())
+		{
+			return A.IsValid() == B.IsValid();
+		}
+
+		if (A->Type != B->Type)
+		{
+			return false;
+		}
+
+		switch (A->Type)
+		{
+		case EJson::Null:
+			return true;
+		case EJson::Boolean:
+			return A->AsBool() == B->AsBool();
+		case EJson::Number:
+		{
+			const double NumberA = A->AsNumber();
+			const double NumberB = B->AsNumber();
+			return FMemory::Memcmp(&NumberA, &NumberB, sizeof(double)) == 0;
+		}
+		case EJson::String:
+			return A->AsString().Equals(B->AsString(), ESearchCase::CaseSensitive);
+		case EJson::Array:
+		{
+			const TArray<TSharedPtr<FJsonValue>>& ArrayA = A->AsArray();
+			const TArray<TSharedPtr<FJsonValue>>& ArrayB = B->AsArray();
+			if (ArrayA.Num() != ArrayB.Num())
+			{
+				return false;
+			}
+			for (int32 Index = 0; Index < ArrayA.Num(); Index++)
+			{
+				if (!SameJson(ArrayA[Index], ArrayB[Index]))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		case EJson::Object:
+		{
+			const TSharedPtr<FJsonObject> ObjectA = A->AsObject();
+			const TSharedPtr<FJsonObject> ObjectB = B->AsObject();
+			if (ObjectA->Values.Num() != ObjectB->Values.Num())
+			{
+				return false;
+			}
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : ObjectA->Values)
+			{
+				const TSharedPtr<FJsonValue>* ValueB = ObjectB->Values.Find(Pair.Key);
+				if (!ValueB || !SameJson(Pair.Value, *ValueB))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+
+	FString Nested(const int32 Depth, const TCHAR* Open, const TCHAR* Leaf, const TCHAR* Close)
+	{
+		FString Json;
+		for (int32 Index = 0; Index < Depth; Index++)
+		{
+			Json += Open;
+		}
+		Json += Leaf;
+		for (int32 Index = 0; Index < Depth; Index++)
+		{
+			Json += Close;
+		}
+		return Json;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeJsonBackendsTest, "glTFRuntime.Json.Backends", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FglTFRuntimeJsonBackendsTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeJsonTests;
+
+	const ANSICHAR* Corpus[] =
+	{
+		// gltf like document
+		"{\"asset\":{\"version\":\"2.0\",\"generator\":\"glTFRuntime\"},\"scene\":0,\"scenes\":[{\"nodes\":[0,1]}],"
+		"\"nodes\":[{\"mesh\":0,\"translation\":[1.5,-2,0.25],\"rotation\":[0,0,0.7071068,0.7071068]},{\"name\":\"empty\",\"children\":[]}],"
+		"\"extras\":{\"flag\":true,\"other\":false,\"nothing\":null}}",
+		// numbers
+		"[0,-0,1,-1,0.5,-0.0,1e3,1E3,1e+3,1e-3,1.25e-7,-2.5E+10,123456789012345678,3.4028234663852886e38,"
+		"1.7976931348623157e308,5e-324,2.2250738585072014e-308,0.1,0.2,0.30000000000000004,9007199254740993]",
+		// escapes
+		"{\"escapes\":\"\\\"\\\\\\/\\b\\f\\n\\r\\t\",\"unicode\":\"\\u0041\\u00e9\\u4e2d end\",\"upper\":\"\\u00C9\\u00c9\"}",
+		// raw UTF-8 (2, 3 and 4 bytes sequences) and the same characters escaped, with surrogate pairs
+		"[\"\xC3\xA9\xE4\xB8\xAD\xF0\x9F\x98\x80\",\"\\u00e9\\u4e2d\\ud83d\\ude00\",\"\\uD834\\uDD1E clef\",\"mixed \xC3\xA9 \\u00e9\"]",
+		// keys needing the slow path and duplicated keys (the last one wins in both backends)
+		"{\"k\xC3\xA9y\":1,\"k\\u00e9y2\":2,\"dup\":1,\"dup\":2}",
+		// whitespaces everywhere
+		" \t\r\n{ \"a\" : [ 1 , 2 , { } , [ ] ] , \"b\" :\t\"x\" }\r\n ",
+		"[]",
+		"{}",
+		"[[],[[]],{\"a\":{}}]",
+	};
+
+	for (const ANSICHAR* Json : Corpus)
+	{
+		int64 ErrorOffset = -1;
+		const TSharedPtr<FJsonValue> Value = ParseUTF8(Json, ErrorOffset);
+		const TSharedPtr<FJsonValue> Reference = ParseReference(Json);
+		const FString Context = UTF8_TO_TCHAR(Json);
+		TestTrue(FString::Printf(TEXT("UTF-8 parse (%s)"), *Context), Value.IsValid());
+		TestTrue(FString::Printf(TEXT("TJsonReader parse (%s)"), *Context), Reference.IsValid());
+		TestTrue(FString::Printf(TEXT("Same DOM (%s)"), *Context), SameJson(Value, Reference));
+	}
+
+	// deep nesting, below the reader recursion limit
+	const FString NestedJsons[] = { Nested(256, TEXT("["), TEXT("1"), TEXT("]")), Nested(256, TEXT("{\"a\":"), TEXT("true"), TEXT("}")) };
+	for (const FString& NestedJson : NestedJsons)
+	{
+		const FTCHARToUTF8 UTF8(*NestedJson);
+		int64 ErrorOffset = -1;
+		const TSharedPtr<FJsonValue> Value = ParseUTF8((const ANSICHAR*)UTF8.Get(), ErrorOffset);
+		TestTrue(TEXT("Deep nesting UTF-8 parse"), Value.IsValid());
+		TestTrue(TEXT("Deep nesting same DOM"), SameJson(Value, ParseReference((const ANSICHAR*)UTF8.Get())));
+	}
+
+	// GLB json chunks can be padded with zeros
+	const uint8 Padded[] = { '{', '"', 'a', '"', ':', '1', '}', 0, 0, 0 };
+	int64 PaddedErrorOffset = -1;
+	TestTrue(TEXT("Zero padded json chunk"), SameJson(FglTFRuntimeParser::ParseUTF8Json(Padded, sizeof(Padded), PaddedErrorOffset), ParseReference("{\"a\":1}")));
+
+	// lone surrogates become U+FFFD
+	int64 SurrogateErrorOffset = -1;
+	const TSharedPtr<FJsonValue> LoneSurrogates = ParseUTF8("[\"\\ud800x\",\"\\udc00\"]", SurrogateErrorOffset);
+	if (TestTrue(TEXT("Lone surrogates parse"), LoneSurrogates.IsValid()))
+	{
+		const TArray<TSharedPtr<FJsonValue>>& Strings = LoneSurrogates->AsArray();
+		TestTrue(TEXT("Lone high surrogate"), Strings.Num() == 2 && Strings[0]->AsString() == FString(TEXT("\xFFFDx")));
+		TestTrue(TEXT("Lone low surrogate"), Strings.Num() == 2 && Strings[1]->AsString() == FString(TEXT("\xFFFD")));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeJsonMalformedTest, "glTFRuntime.Json.Malformed", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FglTFRuntimeJsonMalformedTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeJsonTests;
+
+	const ANSICHAR* Corpus[] =
+	{
+		"",
+		"   ",
+		"{",
+		"[1,2",
+		"[1,]",
+		"{\"a\":1,}",
+		"{\"a\" 1}",
+		"{a:1}",
+		"[1 2]",
+		"[1]]",
+		"{\"a\":1} x",
+		"01",
+		"[01]",
+		"[1.]",
+		"[.5]",
+		"[-]",
+		"[+1]",
+		"[1e]",
+		"[1e+]",
+		"[1-2]",
+		"[tru]",
+		"[nul]",
+		"[True]",
+		"[\"abc]",
+		"[\"\\x\"]",
+		"[\"\\u12G4\"]",
+		"[\"\\u12\"]",
+		"[\"tab\there\"]",
+		"[\"new\nline\"]",
+		"['single']",
+	};
+
+	for (const ANSICHAR* Json : Corpus)
+	{
+		int64 ErrorOffset = -1;
+		const TSharedPtr<FJsonValue> Value = ParseUTF8(Json, ErrorOffset);
+		const FString Context = UTF8_TO_TCHAR(Json);
+		TestFalse(FString::Printf(TEXT("Malformed json is rejected (%s)"), *Context), Value.IsValid());
+		TestTrue(FString::Printf(TEXT("Error offset is reported (%s)"), *Context), ErrorOffset >= 0 && ErrorOffset <= FCStringAnsi::Strlen(Json));
+	}
+
+	// nesting beyond the reader recursion limit is rejected instead of overflowing the stack
+	const FTCHARToUTF8 TooDeep(*Nested(100000, TEXT("["), TEXT(""), TEXT("]")));
+	int64 TooDeepErrorOffset = -1;
+	TestFalse(TEXT("Too deep nesting is rejected"), ParseUTF8((const ANSICHAR*)TooDeep.Get(), TooDeepErrorOffset).IsValid());
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,332 @@
+// Copyright 2020-2022, Roberto De Ioris.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Base64.h"
+#include "glTFRuntimeParser.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/*
+ * The encoded streams come from an encoder written from the EXT_meshopt_compression specification,
+ * the expected bufferViews are the encoder inputs (for the OCTAHEDRAL and QUATERNION filters, the values
+ * reconstructed by the specification formulas in double precision).
+ */
+namespace glTFRuntimeMeshoptTests
+{
+	const uint8 AttributesEncoded[] =
+	{
+		0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0x06, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x04, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02,
+		0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x6e, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e,
+		0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70,
+		0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x6e,
+		0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e,
+		0x70, 0x6e, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70,
+		0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e,
+		0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x6e, 0x70, 0x6e, 0x70,
+		0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x6e,
+		0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e,
+		0x70, 0x6e, 0x70, 0x6e, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70,
+		0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e,
+		0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x6e, 0x70, 0x6e, 0x70,
+		0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70,
+		0x6e, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e,
+		0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70,
+		0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e,
+		0x70, 0x6e, 0x70, 0x6e, 0x70, 0xff, 0xff, 0xff, 0xff, 0x00, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3,
+		0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3,
+		0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3,
+		0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3,
+		0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1,
+		0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3,
+		0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1,
+		0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3,
+		0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc1,
+		0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3,
+		0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3,
+		0xc1, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3,
+		0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3,
+		0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3,
+		0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3,
+		0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3,
+		0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x55, 0x55, 0x55, 0x55, 0x00, 0x02, 0x00, 0x08, 0x00, 0x20, 0x00, 0x80, 0x02, 0x00, 0x08,
+		0x00, 0x20, 0x00, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20, 0x00, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20,
+		0x00, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20, 0x00, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20, 0x00, 0x80,
+		0x02, 0x00, 0x08, 0x00, 0x20, 0x00, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20, 0x00, 0x80, 0x02, 0x00,
+		0x08, 0x00, 0x20, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70,
+		0x6e, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e,
+		0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70, 0x6e, 0x70,
+		0x6e, 0x70, 0x6e, 0x70, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3,
+		0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3,
+		0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0xc1, 0xc3, 0xc3, 0xc3,
+		0xc3, 0xc1, 0xc3, 0xc3, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x02, 0x00, 0x08, 0x00,
+		0x20, 0x00, 0x80, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x12, 0x00, 0x00
+	};
+
+	const uint8 Octahedral8Encoded[] =
+	{
+		0xa0, 0x01, 0x33, 0xff, 0x00, 0x00, 0xfe, 0xfd, 0x30, 0xf2, 0xcd, 0xb1, 0x01, 0x3f, 0xff, 0x00,
+		0x00, 0xfe, 0xfd, 0xfd, 0xb0, 0xdc, 0x39, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00
+	};
+
+	const uint8 Octahedral16Encoded[] =
+	{
+		0xa0, 0x01, 0x12, 0xff, 0x00, 0x00, 0x4b, 0xb6, 0xea, 0xee, 0x01, 0x33, 0xff, 0x00, 0x00, 0xfe,
+		0xfd, 0x2e, 0xf2, 0xcb, 0xb1, 0x01, 0x1a, 0xff, 0x00, 0x00, 0x7e, 0x14, 0xc0, 0xb6, 0x01, 0x3f,
+		0xff, 0x00, 0x00, 0xfe, 0xfd, 0xff, 0xb0, 0xde, 0x39, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00
+	};
+
+	const uint8 QuaternionEncoded[] =
+	{
+		0xa0, 0x01, 0x03, 0xf0, 0x00, 0x00, 0x51, 0xfb, 0x58, 0x01, 0x03, 0xf0, 0x00, 0x00, 0x03, 0x07,
+		0x04, 0x01, 0x0b, 0xf0, 0x00, 0x00, 0xa5, 0x0d, 0xa9, 0x01, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0x0a,
+		0x10, 0x05, 0x01, 0x1b, 0xf0, 0x00, 0x00, 0xf5, 0x57, 0x5f, 0x02, 0x0e, 0xd7, 0x3e, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x01, 0x3b, 0xc0, 0x00, 0x00, 0x05, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07
+	};
+
+	const uint8 ExponentialEncoded[] =
+	{
+		0xa0, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x14, 0x01,
+		0x34, 0x00, 0x00, 0x00, 0x06, 0x01, 0x24, 0x00, 0x00, 0x00, 0x01, 0x3c, 0x00, 0x00, 0x00, 0xfd,
+		0xfe, 0x01, 0x3c, 0x00, 0x00, 0x00, 0x2b, 0x9f, 0x01, 0x3c, 0x00, 0x00, 0x00, 0x73, 0xca, 0x01,
+		0x38, 0x00, 0x00, 0x00, 0x61, 0x01, 0x3c, 0x00, 0x00, 0x00, 0xfe, 0xfd, 0x01, 0x3c, 0x00, 0x00,
+		0x00, 0x18, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x39,
+		0x30, 0x00, 0xf6
+	};
+
+	const uint8 Triangles16Encoded[] =
+	{
+		0xe1, 0xf0, 0x10, 0x00, 0x10, 0xf0, 0x16, 0xbf, 0x7f, 0x1d, 0x11, 0xf0, 0x1f, 0xfe, 0xff, 0x1e,
+		0xf0, 0xff, 0x10, 0xb8, 0x01, 0xc5, 0x01, 0xdf, 0x02, 0xff, 0x4e, 0x02, 0x02, 0xff, 0x47, 0x01,
+		0x05, 0x00, 0x76, 0x87, 0x56, 0x67, 0x78, 0xa9, 0x86, 0x65, 0x89, 0x68, 0x98, 0x01, 0x69, 0x00,
+		0x00
+	};
+
+	const uint8 Triangles32Encoded[] =
+	{
+		0xe1, 0xf0, 0x10, 0x00, 0x10, 0xf0, 0x16, 0xbf, 0x7f, 0x1d, 0x11, 0xf0, 0x1f, 0xfe, 0xff, 0x1e,
+		0xf0, 0xff, 0x10, 0x98, 0xc7, 0x08, 0xa5, 0xc7, 0x08, 0xdf, 0x02, 0xff, 0xae, 0xc6, 0x08, 0x02,
+		0x02, 0xff, 0xa7, 0xc6, 0x08, 0x01, 0x05, 0x00, 0x76, 0x87, 0x56, 0x67, 0x78, 0xa9, 0x86, 0x65,
+		0x89, 0x68, 0x98, 0x01, 0x69, 0x00, 0x00
+	};
+
+	const uint8 IndicesEncoded[] =
+	{
+		0xd1, 0x00, 0x04, 0x04, 0x04, 0x94, 0x1f, 0x11, 0x04, 0x05, 0x05, 0x05, 0x9c, 0xec, 0x10, 0xc2,
+		0x8b, 0x01, 0x05, 0x17, 0x07, 0x84, 0x92, 0x0e, 0x02, 0x25, 0x00, 0x00, 0x00, 0x00
+	};
+
+	const uint8 Indices16Encoded[] =
+	{
+		0xd1, 0x00, 0x04, 0x04, 0x04, 0x94, 0x1f, 0x11, 0x04, 0x05, 0x05, 0x05, 0x9c, 0x6c, 0xbc, 0xf4,
+		0x0e, 0x05, 0x17, 0x07, 0xfa, 0xed, 0x01, 0x02, 0x25, 0x00, 0x00, 0x00, 0x00
+	};
+
+	const int8 Octahedral8Decoded[] =
+	{
+		0, 0, 127, 0, 0, 0, -127, 0, 127, 0, 0, 0, 0, -127, 0, 0,
+		39, -63, 103, 0, -89, 25, -87, 0, 73, 73, 74, 0, -13, -114, -54, 0
+	};
+
+	const int16 Octahedral16Decoded[] =
+	{
+		0, 0, 32767, 0, 0, 0, -32767, 0, 32767, 0, 0, 0, 0, -32767, 0, 0,
+		9850, -16416, 26593, 0, -23025, 6579, -22366, 0, 18917, 18917, 18919, 0, -3283, -29544, -13786, 0
+	};
+
+	const int16 QuaternionDecoded[] =
+	{
+		0, 0, 0, 32767, 23170, 0, 0, 23170, 0, 23170, 0, -23170, -3362, -6723, -10085, 30257,
+		16399, -16378, 16378, -16378, 30257, -10085, 6723, 3362
+	};
+
+	const uint32 ExponentialDecoded[] =
+	{
+		0x3f800000, 0xbfc00000, 0x4140e400, 0x00000000, 0xbf800000, 0x4bfffffe,
+		0x45a00000, 0x8c000000, 0x40c80000
+	};
+
+	const uint16 Triangles16Decoded[] =
+	{
+		0, 1, 2, 2, 1, 3, 2, 3, 4, 4, 3, 5, 6, 7, 8, 8, 7, 2,
+		0, 2, 8, 4, 5, 100, 100, 5, 99, 99, 5, 100, 9, 10, 11, 11, 10, 0,
+		12, 3, 1, 40, 41, 42, 42, 41, 43, 13, 14, 15, 7, 6, 3
+	};
+
+	const uint32 Triangles32Decoded[] =
+	{
+		0, 1, 2, 2, 1, 3, 2, 3, 4, 4, 3, 5, 6, 7, 8, 8, 7, 2,
+		0, 2, 8, 4, 5, 70100, 70100, 5, 70099, 70099, 5, 70100, 9, 10, 11, 11, 10, 0,
+		12, 3, 1, 70040, 70041, 70042, 70042, 70041, 70043, 13, 14, 15, 7, 6, 3
+	};
+
+	const uint32 IndicesDecoded[] =
+	{
+		0, 1, 2, 3, 1000, 4, 1001, 5, 6, 7, 70000, 65535, 8, 2, 0, 123456, 123455, 9
+	};
+
+	const uint16 Indices16Decoded[] =
+	{
+		0, 1, 2, 3, 1000, 4, 1001, 5, 6, 7, 4464, 65535, 8, 2, 0, 57920, 57919, 9
+	};
+
+	// 300 vertices (two vertex blocks) mixing smooth, random, constant and rarely changing 16 bit components
+	void BuildAttributes(TArray64<uint8>& Bytes)
+	{
+		for (uint32 VertexIndex = 0; VertexIndex < 300; VertexIndex++)
+		{
+			const uint16 Components[4] = { (uint16)(VertexIndex * 3), (uint16)((VertexIndex * 2654435761u) >> 16), 0x1234, (uint16)(VertexIndex / 7) };
+			Bytes.Append(reinterpret_cast<const uint8*>(Components), sizeof(Components));
+		}
+	}
+
+	// a single EXT_meshopt_compression bufferView, the fallback buffer has no data
+	TSharedPtr<FglTFRuntimeParser> MakeParser(const uint8* Encoded, const int32 EncodedNum, const int32 Stride, const int32 Count, const TCHAR* Mode, const TCHAR* Filter)
+	{
+		const FString Json = FString::Printf(TEXT("{\"asset\":{\"version\":\"2.0\"},\"extensionsUsed\":[\"EXT_meshopt_compression\"],")
+			TEXT("\"buffers\":[{\"byteLength\":%d,\"uri\":\"data:application/octet-stream;base64,%s\"},{\"byteLength\":%d,\"extensions\":{\"EXT_meshopt_compression\":{\"fallback\":true}}}],")
+			TEXT("\"bufferViews\":[{\"buffer\":1,\"byteLength\":%d,\"extensions\":{\"EXT_meshopt_compression\":{\"buffer\":0,\"byteLength\":%d,\"byteStride\":%d,\"count\":%d,\"mode\":\"%s\",\"filter\":\"%s\"}}}]}"),
+			EncodedNum, *FBase64::Encode(TArray<uint8>(Encoded, EncodedNum)), Stride * Count, Stride * Count, EncodedNum, Stride, Count, Mode, Filter);
+
+		return FglTFRuntimeParser::FromString(Json, FglTFRuntimeConfig());
+	}
+
+	bool Decode(const uint8* Encoded, const int32 EncodedNum, const int32 Stride, const int32 Count, const TCHAR* Mode, const TCHAR* Filter, TArray64<uint8>& Bytes)
+	{
+		TSharedPtr<FglTFRuntimeParser> Parser = MakeParser(Encoded, EncodedNum, Stride, Count, Mode, Filter);
+		if (!Parser)
+		{
+			return false;
+		}
+
+		int64 BufferViewStride = 0;
+		return Parser->GetBufferView(0, Bytes, BufferViewStride);
+	}
+
+	// the filters use float math, allow one unit of difference from the double precision reference
+	template<typename T>
+	bool NearlyEqual(const TArray64<uint8>& Bytes, const T* Expected, const int32 ExpectedNum)
+	{
+		if (Bytes.Num() != ExpectedNum * (int64)sizeof(T))
+		{
+			return false;
+		}
+
+		const T* Values = reinterpret_cast<const T*>(Bytes.GetData());
+		for (int32 Index = 0; Index < ExpectedNum; Index++)
+		{
+			if (FMath::Abs((int32)Values[Index] - (int32)Expected[Index]) > 1)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template<typename T>
+	bool Equal(const TArray64<uint8>& Bytes, const T* Expected, const int32 ExpectedNum)
+	{
+		return Bytes.Num() == ExpectedNum * (int64)sizeof(T) && FMemory::Memcmp(Bytes.GetData(), Expected, Bytes.Num()) == 0;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeMeshoptAttributesTest, "glTFRuntime.Meshopt.Attributes", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FglTFRuntimeMeshoptAttributesTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeMeshoptTests;
+
+	TArray64<uint8> Expected;
+	BuildAttributes(Expected);
+
+	TArray64<uint8> Bytes;
+	TestTrue(TEXT("Decode attributes"), Decode(AttributesEncoded, UE_ARRAY_COUNT(AttributesEncoded), 8, 300, TEXT("ATTRIBUTES"), TEXT("NONE"), Bytes));
+	TestTrue(TEXT("Attributes match"), Bytes == Expected);
+
+	Bytes.Empty();
+	TestTrue(TEXT("Decode 8 bit octahedral normals"), Decode(Octahedral8Encoded, UE_ARRAY_COUNT(Octahedral8Encoded), 4, 8, TEXT("ATTRIBUTES"), TEXT("OCTAHEDRAL"), Bytes));
+	TestTrue(TEXT("8 bit octahedral normals match"), NearlyEqual(Bytes, Octahedral8Decoded, UE_ARRAY_COUNT(Octahedral8Decoded)));
+
+	Bytes.Empty();
+	TestTrue(TEXT("Decode 16 bit octahedral normals"), Decode(Octahedral16Encoded, UE_ARRAY_COUNT(Octahedral16Encoded), 8, 8, TEXT("ATTRIBUTES"), TEXT("OCTAHEDRAL"), Bytes));
+	TestTrue(TEXT("16 bit octahedral normals match"), NearlyEqual(Bytes, Octahedral16Decoded, UE_ARRAY_COUNT(Octahedral16Decoded)));
+
+	Bytes.Empty();
+	TestTrue(TEXT("Decode quaternions"), Decode(QuaternionEncoded, UE_ARRAY_COUNT(QuaternionEncoded), 8, 6, TEXT("ATTRIBUTES"), TEXT("QUATERNION"), Bytes));
+	TestTrue(TEXT("Quaternions match"), NearlyEqual(Bytes, QuaternionDecoded, UE_ARRAY_COUNT(QuaternionDecoded)));
+
+	// mantissa * 2^exponent is exact, the floats are compared bitwise
+	Bytes.Empty();
+	TestTrue(TEXT("Decode exponential floats"), Decode(ExponentialEncoded, UE_ARRAY_COUNT(ExponentialEncoded), 12, 3, TEXT("ATTRIBUTES"), TEXT("EXPONENTIAL"), Bytes));
+	TestTrue(TEXT("Exponential floats match"), Equal(Bytes, ExponentialDecoded, UE_ARRAY_COUNT(ExponentialDecoded)));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeMeshoptIndicesTest, "glTFRuntime.Meshopt.Indices", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FglTFRuntimeMeshoptIndicesTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeMeshoptTests;
+
+	// edge and vertex fifo hits, +-1 and explicit third vertices, table and explicit codeaux triangles
+	TArray64<uint8> Bytes;
+	TestTrue(TEXT("Decode 16 bit triangles"), Decode(Triangles16Encoded, UE_ARRAY_COUNT(Triangles16Encoded), 2, UE_ARRAY_COUNT(Triangles16Decoded), TEXT("TRIANGLES"), TEXT("NONE"), Bytes));
+	TestTrue(TEXT("16 bit triangles match"), Equal(Bytes, Triangles16Decoded, UE_ARRAY_COUNT(Triangles16Decoded)));
+
+	Bytes.Empty();
+	TestTrue(TEXT("Decode 32 bit triangles"), Decode(Triangles32Encoded, UE_ARRAY_COUNT(Triangles32Encoded), 4, UE_ARRAY_COUNT(Triangles32Decoded), TEXT("TRIANGLES"), TEXT("NONE"), Bytes));
+	TestTrue(TEXT("32 bit triangles match"), Equal(Bytes, Triangles32Decoded, UE_ARRAY_COUNT(Triangles32Decoded)));
+
+	Bytes.Empty();
+	TestTrue(TEXT("Decode 32 bit index sequence"), Decode(IndicesEncoded, UE_ARRAY_COUNT(IndicesEncoded), 4, UE_ARRAY_COUNT(IndicesDecoded), TEXT("INDICES"), TEXT("NONE"), Bytes));
+	TestTrue(TEXT("32 bit index sequence matches"), Equal(Bytes, IndicesDecoded, UE_ARRAY_COUNT(IndicesDecoded)));
+
+	Bytes.Empty();
+	TestTrue(TEXT("Decode 16 bit index sequence"), Decode(Indices16Encoded, UE_ARRAY_COUNT(Indices16Encoded), 2, UE_ARRAY_COUNT(Indices16Decoded), TEXT("INDICES"), TEXT("NONE"), Bytes));
+	TestTrue(TEXT("16 bit index sequence matches"), Equal(Bytes, Indices16Decoded, UE_ARRAY_COUNT(Indices16Decoded)));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeMeshoptMalformedTest, "glTFRuntime.Meshopt.Malformed", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FglTFRuntimeMeshoptMalformedTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeMeshoptTests;
+
+	AddExpectedError(TEXT("Unable to decode EXT_meshopt_compression"), EAutomationExpectedErrorFlags::Contains, 4);
+
+	// truncated streams
+	TArray64<uint8> Bytes;
+	TestFalse(TEXT("Truncated attributes are rejected"), Decode(AttributesEncoded, UE_ARRAY_COUNT(AttributesEncoded) - 1, 8, 300, TEXT("ATTRIBUTES"), TEXT("NONE"), Bytes));
+	TestFalse(TEXT("Truncated triangles are rejected"), Decode(Triangles16Encoded, UE_ARRAY_COUNT(Triangles16Encoded) - 1, 2, UE_ARRAY_COUNT(Triangles16Decoded), TEXT("TRIANGLES"), TEXT("NONE"), Bytes));
+	TestFalse(TEXT("Truncated index sequences are rejected"), Decode(IndicesEncoded, UE_ARRAY_COUNT(IndicesEncoded) - 1, 4, UE_ARRAY_COUNT(IndicesDecoded), TEXT("INDICES"), TEXT("NONE"), Bytes));
+
+	// attributes stream decoded as triangles (wrong header)
+	TestFalse(TEXT("Wrong stream header is rejected"), Decode(AttributesEncoded, UE_ARRAY_COUNT(AttributesEncoded), 4, 300, TEXT("TRIANGLES"), TEXT("NONE"), Bytes));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,311 @@
+// Copyright 2020-2022, Roberto De Ioris.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "glTFRuntimeParser.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace glTFRuntimePrimitivesTests
+{
+	TSharedRef<FglTFRuntimePrimitive> MakePrimitive()
+	{
+		TSharedRef<FglTFRuntimePrimitive> Primitive = MakeShared<FglTFRuntimePrimitive>();
+		Primitive->Material = nullptr;
+		return Primitive;
+	}
+
+	// the primitives helpers do not need a document, a metadata only parser skips base materials loading
+	TSharedRef<FglTFRuntimeParser> MakeParser()
+	{
+		return MakeShared<FglTFRuntimeParser>(MakeShared<FJsonObject>(), FMatrix::Identity, 1, true);
+	}
+
+	// Size x Size quads on the XY plane (one unit each), as a non-indexed triangle soup
+	void BuildGridSoup(const int32 Size, const float Noise, FRandomStream& RandomStream, FglTFRuntimePrimitive& Primitive)
+	{
+		Primitive.UVs.AddDefaulted();
+		auto AddVertex = [&](const int32 X, const int32 Y)
+		{
+			const FVector Jitter(RandomStream.FRandRange(-Noise, Noise), RandomStream.FRandRange(-Noise, Noise), RandomStream.FRandRange(-Noise, Noise));
+			Primitive.Indices.Add(Primitive.Positions.Add(FVector(X, Y, 0) + Jitter));
+			Primitive.Normals.Add(FVector(0, 0, 1));
+			Primitive.UVs[0].Add(FVector2D((float)X / Size, (float)Y / Size));
+		};
+
+		for (int32 Y = 0; Y < Size; Y++)
+		{
+			for (int32 X = 0; X < Size; X++)
+			{
+				AddVertex(X, Y);
+				AddVertex(X + 1, Y);
+				AddVertex(X + 1, Y + 1);
+				AddVertex(X, Y);
+				AddVertex(X + 1, Y + 1);
+				AddVertex(X, Y + 1);
+			}
+		}
+		Primitive.bHasSynthesizedIndices = true;
+	}
+
+	// Size x Size quads on the XY plane, indexed, with the triangles in random order
+	void BuildScrambledGrid(const int32 Size, FRandomStream& RandomStream, FglTFRuntimePrimitive& Primitive)
+	{
+		Primitive.UVs.AddDefaulted();
+		for (int32 Y = 0; Y <= Size; Y++)
+		{
+			for (int32 X = 0; X <= Size; X++)
+			{
+				Primitive.Positions.Add(FVector(X, Y, 0));
+				Primitive.Normals.Add(FVector(0, 0, 1));
+				Primitive.UVs[0].Add(FVector2D((float)X / Size, (float)Y / Size));
+			}
+		}
+
+		TArray<FIntVector> Triangles;
+		for (int32 Y = 0; Y < Size; Y++)
+		{
+			for (int32 X = 0; X < Size; X++)
+			{
+				const int32 Corner = Y * (Size + 1) + X;
+				Triangles.Add(FIntVector(Corner, Corner + 1, Corner + Size + 2));
+				Triangles.Add(FIntVector(Corner, Corner + Size + 2, Corner + Size + 1));
+			}
+		}
+
+		for (int32 TriangleIndex = Triangles.Num() - 1; TriangleIndex > 0; TriangleIndex--)
+		{
+			Triangles.Swap(TriangleIndex, RandomStream.RandRange(0, TriangleIndex));
+		}
+
+		for (const FIntVector& Triangle : Triangles)
+		{
+			Primitive.Indices.Add(Triangle.X);
+			Primitive.Indices.Add(Triangle.Y);
+			Primitive.Indices.Add(Triangle.Z);
+		}
+	}
+
+	// Size x Size quads on the XY plane, indexed, with an uv seam splitting the vertices of the middle column
+	void BuildSeamedGrid(const int32 Size, FglTFRuntimePrimitive& Primitive)
+	{
+		Primitive.UVs.AddDefaulted();
+		TArray<int32> LeftVertices;
+		TArray<int32> RightVertices;
+		for (int32 Y = 0; Y <= Size; Y++)
+		{
+			for (int32 X = 0; X <= Size; X++)
+			{
+				const bool bLeft = X <= Size / 2;
+				const bool bRight = X >= Size / 2;
+				for (int32 Side = 0; Side < 2; Side++)
+				{
+					if ((Side == 0 && !bLeft) || (Side == 1 && !bRight))
+					{
+						(Side == 0 ? LeftVertices : RightVertices).Add(INDEX_NONE);
+						continue;
+					}
+					(Side == 0 ? LeftVertices : RightVertices).Add(Primitive.Positions.Add(FVector(X, Y, 0)));
+					Primitive.Normals.Add(FVector(0, 0, 1));
+					Primitive.UVs[0].Add(FVector2D((float)X / Size + Side, (float)Y / Size));
+				}
+			}
+		}
+
+		for (int32 Y = 0; Y < Size; Y++)
+		{
+			for (int32 X = 0; X < Size; X++)
+			{
+				const TArray<int32>& Vertices = X < Size / 2 ? LeftVertices : RightVertices;
+				const int32 Corner = Y * (Size + 1) + X;
+				Primitive.Indices.Append({ (uint32)Vertices[Corner], (uint32)Vertices[Corner + 1], (uint32)Vertices[Corner + Size + 2] });
+				Primitive.Indices.Append({ (uint32)Vertices[Corner], (uint32)Vertices[Corner + Size + 2], (uint32)Vertices[Corner + Size + 1] });
+			}
+		}
+	}
+
+	// average cache miss ratio of a 16 entries FIFO cache
+	float ComputeACMR(const FglTFRuntimePrimitive& Primitive)
+	{
+		TArray<uint32> Cache;
+		int32 Misses = 0;
+		for (const uint32 VertexIndex : Primitive.Indices)
+		{
+			if (!Cache.Contains(VertexIndex))
+			{
+				Misses++;
+				Cache.Add(VertexIndex);
+				if (Cache.Num() > 16)
+				{
+					Cache.RemoveAt(0);
+				}
+			}
+		}
+		return static_cast<float>(Misses) / (Primitive.Indices.Num() / 3);
+	}
+
+	// triangles identified by the grid coordinates of their corners, rotated to start from the lowest one (winding is kept)
+	TArray<int64> GetGridTriangles(const int32 Size, const FglTFRuntimePrimitive& Primitive)
+	{
+		TArray<int64> Triangles;
+		for (int32 Index = 0; Index + 2 < Primitive.Indices.Num(); Index += 3)
+		{
+			int64 Corners[3];
+			for (int32 Corner = 0; Corner < 3; Corner++)
+			{
+				const FVector& Position = Primitive.Positions[Primitive.Indices[Index + Corner]];
+				Corners[Corner] = FMath::RoundToInt(Position.Y) * (Size + 1) + FMath::RoundToInt(Position.X);
+			}
+			const int32 First = Corners[0] < Corners[1] ? (Corners[0] < Corners[2] ? 0 : 2) : (Corners[1] < Corners[2] ? 1 : 2);
+			Triangles.Add((Corners[First] << 40) | (Corners[(First + 1) % 3] << 20) | Corners[(First + 2) % 3]);
+		}
+		Triangles.Sort();
+		return Triangles;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimePrimitivesWeldTest, "glTFRuntime.Primitives.Weld", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FglTFRuntimePrimitivesWeldTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimePrimitivesTests;
+
+	TSharedRef<FglTFRuntimeParser> Parser = MakeParser();
+	FRandomStream RandomStream(31);
+
+	const int32 Size = 16;
+	const int32 ExpectedVertices = (Size + 1) * (Size + 1);
+	// grid corners lie on cell boundaries (1 / 0.01), so the noise makes copies of the same corner straddle them
+	const float Epsilon = 0.01f;
+
+	{
+		TSharedRef<FglTFRuntimePrimitive> Primitive = MakePrimitive();
+		BuildGridSoup(Size, Epsilon * 0.45f, RandomStream, *Primitive);
+
+		const TArray<FVector> SourcePositions = Primitive->Positions;
+		const int32 VerticesBefore = Primitive->Positions.Num();
+		TestTrue(TEXT("WeldPrimitive"), Parser->WeldPrimitive(*Primitive, Epsilon, 0.001f, 0.0001f));
+		const int32 VerticesAfter = Primitive->Positions.Num();
+		AddInfo(FString::Printf(TEXT("Noisy grid vertices: %d -> %d"), VerticesBefore, VerticesAfter));
+
+		TestEqual(TEXT("Welded vertices"), VerticesAfter, ExpectedVertices);
+		TestEqual(TEXT("Indices count is preserved"), Primitive->Indices.Num(), SourcePositions.Num());
+		TestFalse(TEXT("Indices are no more synthesized"), Primitive->bHasSynthesizedIndices);
+
+		bool bCornersMatch = true;
+		for (int32 Index = 0; Index < Primitive->Indices.Num(); Index++)
+		{
+			bCornersMatch = bCornersMatch && FVector::DistSquared(Primitive->Positions[Primitive->Indices[Index]], SourcePositions[Index]) <= FMath::Square(Epsilon * 2);
+		}
+		TestTrue(TEXT("Every corner references a vertex within epsilon"), bCornersMatch);
+	}
+
+	// the same soup with the normals of one half flipped, copies with different normals must not be merged
+	{
+		TSharedRef<FglTFRuntimePrimitive> Primitive = MakePrimitive();
+		BuildGridSoup(Size, 0, RandomStream, *Primitive);
+		for (int32 VertexIndex = 0; VertexIndex < Primitive->Normals.Num(); VertexIndex++)
+		{
+			if ((VertexIndex / 3) % 2)
+			{
+				Primitive->Normals[VertexIndex] = FVector(0, 0, -1);
+			}
+		}
+
+		const int32 VerticesBefore = Primitive->Positions.Num();
+		TestTrue(TEXT("WeldPrimitive"), Parser->WeldPrimitive(*Primitive, Epsilon, 0.001f, 0.0001f));
+		const int32 VerticesAfter = Primitive->Positions.Num();
+		AddInfo(FString::Printf(TEXT("Hard edged grid vertices: %d -> %d"), VerticesBefore, VerticesAfter));
+
+		// the first triangle of each quad only uses 3 corners of it, the second one the other diagonal half
+		bool bNormalsPreserved = true;
+		for (int32 Index = 0; Index < Primitive->Indices.Num(); Index++)
+		{
+			bNormalsPreserved = bNormalsPreserved && Primitive->Normals[Primitive->Indices[Index]].Z == (((Index / 3) % 2) ? -1 : 1);
+		}
+		TestTrue(TEXT("Vertices with different normals are not merged"), bNormalsPreserved);
+		TestTrue(TEXT("Vertices are welded on each side"), VerticesAfter < VerticesBefore && VerticesAfter > ExpectedVertices);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimePrimitivesOptimizeTest, "glTFRuntime.Primitives.Optimize", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FglTFRuntimePrimitivesOptimizeTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimePrimitivesTests;
+
+	TSharedRef<FglTFRuntimeParser> Parser = MakeParser();
+	FRandomStream RandomStream(17);
+
+	const int32 Size = 32;
+
+	TSharedRef<FglTFRuntimePrimitive> Primitive = MakePrimitive();
+	BuildScrambledGrid(Size, RandomStream, *Primitive);
+
+	const TArray<int64> SourceTriangles = GetGridTriangles(Size, *Primitive);
+	const int32 VerticesBefore = Primitive->Positions.Num();
+	const float ACMRBefore = ComputeACMR(*Primitive);
+	TestTrue(TEXT("OptimizePrimitive"), Parser->OptimizePrimitive(*Primitive, true, true, 1.05f, true));
+	const float ACMRAfter = ComputeACMR(*Primitive);
+	AddInfo(FString::Printf(TEXT("Scrambled grid ACMR: %f -> %f"), ACMRBefore, ACMRAfter));
+
+	// a random order misses almost every vertex, a vertex cache friendly one reuses most of them
+	TestTrue(TEXT("ACMR is improved"), ACMRAfter < ACMRBefore * 0.5f);
+	TestEqual(TEXT("Vertices count is preserved"), Primitive->Positions.Num(), VerticesBefore);
+	TestEqual(TEXT("Normals follow the vertices"), Primitive->Normals.Num(), VerticesBefore);
+	TestTrue(TEXT("Triangles set and winding are preserved"), GetGridTriangles(Size, *Primitive) == SourceTriangles);
+
+	bool bUVsFollowPositions = true;
+	for (int32 VertexIndex = 0; VertexIndex < Primitive->Positions.Num(); VertexIndex++)
+	{
+		bUVsFollowPositions = bUVsFollowPositions && Primitive->UVs[0][VertexIndex].Equals(FVector2D(Primitive->Positions[VertexIndex].X / Size, Primitive->Positions[VertexIndex].Y / Size));
+	}
+	TestTrue(TEXT("UVs are remapped with the positions"), bUVsFollowPositions);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimePrimitivesSimplifyTest, "glTFRuntime.Primitives.Simplify", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FglTFRuntimePrimitivesSimplifyTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimePrimitivesTests;
+
+	TSharedRef<FglTFRuntimeParser> Parser = MakeParser();
+
+	const int32 Size = 16;
+
+	TSharedRef<FglTFRuntimePrimitive> Primitive = MakePrimitive();
+	BuildSeamedGrid(Size, *Primitive);
+
+	FglTFRuntimePrimitive SimplifiedPrimitive;
+	TestTrue(TEXT("SimplifyPrimitive"), Parser->SimplifyPrimitive(*Primitive, 0.25f, SimplifiedPrimitive));
+	AddInfo(FString::Printf(TEXT("Seamed grid triangles: %d -> %d"), Primitive->Indices.Num() / 3, SimplifiedPrimitive.Indices.Num() / 3));
+
+	// the seam runs through the whole grid, it must not stop the simplification
+	TestTrue(TEXT("Triangles are reduced"), SimplifiedPrimitive.Indices.Num() <= Primitive->Indices.Num() / 2);
+
+	bool bSidesPreserved = true;
+	for (int32 Index = 0; Index < SimplifiedPrimitive.Indices.Num(); Index += 3)
+	{
+		// the uvs of a triangle must all come from the same side of the seam
+		const bool bRight = SimplifiedPrimitive.UVs[0][SimplifiedPrimitive.Indices[Index]].X > 1;
+		for (int32 Corner = 0; Corner < 3; Corner++)
+		{
+			const FVector2D UV = SimplifiedPrimitive.UVs[0][SimplifiedPrimitive.Indices[Index + Corner]];
+			const FVector Position = SimplifiedPrimitive.Positions[SimplifiedPrimitive.Indices[Index + Corner]];
+			bSidesPreserved = bSidesPreserved && (UV.X > 1) == bRight && FMath::IsNearlyEqual(UV.X - (bRight ? 1 : 0), Position.X / Size);
+		}
+	}
+	TestTrue(TEXT("Seam is not crossed"), bSidesPreserved);
+
+	FBox SourceBounds(Primitive->Positions);
+	FBox SimplifiedBounds(SimplifiedPrimitive.Positions);
+	TestTrue(TEXT("Borders are preserved"), SourceBounds.Min.Equals(SimplifiedBounds.Min) && SourceBounds.Max.Equals(SimplifiedBounds.Max));
+
+	return true;
+}
+
+#endif
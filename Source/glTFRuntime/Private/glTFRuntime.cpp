@@ -1,15 +1,18 @@
 // Copyright 2020, Roberto De Ioris.
 
 #include "glTFRuntime.h"
+#include "glTFRuntimeTaskScheduler.h"
 
 #define LOCTEXT_NAMESPACE "FglTFRuntimeModule"
 
 void FglTFRuntimeModule::StartupModule()
 {
+	FglTFRuntimeTaskScheduler::Startup();
 }
 
 void FglTFRuntimeModule::ShutdownModule()
 {
+	FglTFRuntimeTaskScheduler::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
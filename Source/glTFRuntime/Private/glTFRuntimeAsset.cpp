@@ -34,6 +34,8 @@ bool UglTFRuntimeAsset::LoadFromFilename(const FString& Filename, const FglTFRun
 		Parser->OnError.Add(Delegate);
 		Delegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UglTFRuntimeAsset, OnStaticMeshCreatedProxy));
 		Parser->OnStaticMeshCreated.Add(Delegate);
+		Delegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UglTFRuntimeAsset, OnStaticMeshPhysicsCookedProxy));
+		Parser->OnStaticMeshPhysicsCooked.Add(Delegate);
 		Delegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UglTFRuntimeAsset, OnSkeletalMeshCreatedProxy));
 		Parser->OnSkeletalMeshCreated.Add(Delegate);
 	}
@@ -56,6 +58,8 @@ bool UglTFRuntimeAsset::LoadFromString(const FString& JsonData, const FglTFRunti
 		Parser->OnError.Add(Delegate);
 		Delegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UglTFRuntimeAsset, OnStaticMeshCreatedProxy));
 		Parser->OnStaticMeshCreated.Add(Delegate);
+		Delegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UglTFRuntimeAsset, OnStaticMeshPhysicsCookedProxy));
+		Parser->OnStaticMeshPhysicsCooked.Add(Delegate);
 		Delegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UglTFRuntimeAsset, OnSkeletalMeshCreatedProxy));
 		Parser->OnSkeletalMeshCreated.Add(Delegate);
 	}
@@ -78,6 +82,8 @@ bool UglTFRuntimeAsset::LoadFromData(const uint8* DataPtr, int64 DataNum, const
 		Parser->OnError.Add(Delegate);
 		Delegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UglTFRuntimeAsset, OnStaticMeshCreatedProxy));
 		Parser->OnStaticMeshCreated.Add(Delegate);
+		Delegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UglTFRuntimeAsset, OnStaticMeshPhysicsCookedProxy));
+		Parser->OnStaticMeshPhysicsCooked.Add(Delegate);
 		Delegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UglTFRuntimeAsset, OnSkeletalMeshCreatedProxy));
 		Parser->OnSkeletalMeshCreated.Add(Delegate);
 	}
@@ -100,6 +106,14 @@ void UglTFRuntimeAsset::OnStaticMeshCreatedProxy(UStaticMesh* StaticMesh)
 	}
 }
 
+void UglTFRuntimeAsset::OnStaticMeshPhysicsCookedProxy(UStaticMesh* StaticMesh)
+{
+	if (OnStaticMeshPhysicsCooked.IsBound())
+	{
+		OnStaticMeshPhysicsCooked.Broadcast(StaticMesh);
+	}
+}
+
 void UglTFRuntimeAsset::OnSkeletalMeshCreatedProxy(USkeletalMesh* SkeletalMesh)
 {
 	if (OnSkeletalMeshCreated.IsBound())
@@ -229,6 +243,13 @@ TArray<FString> UglTFRuntimeAsset::GetCamerasNames()
 	return Parser->GetCamerasNames();
 }
 
+TArray<FString> UglTFRuntimeAsset::GetAnimationsNames()
+{
+	GLTF_CHECK_PARSER(TArray<FString>());
+
+	return Parser->GetAnimationsNames();
+}
+
 UStaticMesh* UglTFRuntimeAsset::LoadStaticMesh(const int32 MeshIndex, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig)
 {
 	GLTF_CHECK_PARSER(nullptr);
@@ -27,6 +27,11 @@ void AglTFRuntimeAssetActor::BeginPlay()
 		return;
 	}
 
+	if (StaticMeshConfig.bAsyncPhysicsCooking)
+	{
+		Asset->OnStaticMeshPhysicsCooked.AddUniqueDynamic(this, &AglTFRuntimeAssetActor::OnStaticMeshPhysicsCooked);
+	}
+
 	TArray<FglTFRuntimeScene> Scenes = Asset->GetScenes();
 	for (FglTFRuntimeScene& Scene : Scenes)
 	{
@@ -124,6 +129,10 @@ void AglTFRuntimeAssetActor::ProcessNode(USceneComponent* NodeParentComponent, c
 				}
 			}
 			StaticMeshComponent->SetStaticMesh(StaticMesh);
+			if (StaticMesh && StaticMeshConfig.bAsyncPhysicsCooking)
+			{
+				StaticMeshComponentsCooking.FindOrAdd(StaticMesh).Add(StaticMeshComponent);
+			}
 			ReceiveOnStaticMeshComponentCreated(StaticMeshComponent, Node);
 			NewComponent = StaticMeshComponent;
 		}
@@ -243,6 +252,24 @@ void AglTFRuntimeAssetActor::SetCurveAnimationByName(const FString& CurveAnimati
 
 }
 
+void AglTFRuntimeAssetActor::OnStaticMeshPhysicsCooked(UStaticMesh* StaticMesh)
+{
+	TArray<TWeakObjectPtr<UStaticMeshComponent>> StaticMeshComponents;
+	if (!StaticMeshComponentsCooking.RemoveAndCopyValue(StaticMesh, StaticMeshComponents))
+	{
+		return;
+	}
+
+	// the components got the mesh before its collision was ready
+	for (const TWeakObjectPtr<UStaticMeshComponent>& StaticMeshComponent : StaticMeshComponents)
+	{
+		if (StaticMeshComponent.IsValid() && StaticMeshComponent->GetStaticMesh() == StaticMesh && StaticMeshComponent->IsPhysicsStateCreated())
+		{
+			StaticMeshComponent->RecreatePhysicsState();
+		}
+	}
+}
+
 // Called every frame
 void AglTFRuntimeAssetActor::Tick(float DeltaTime)
 {
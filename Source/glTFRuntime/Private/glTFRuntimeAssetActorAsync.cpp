@@ -13,6 +13,8 @@ AglTFRuntimeAssetActorAsync::AglTFRuntimeAssetActorAsync()
 
 	AssetRoot = CreateDefaultSubobject<USceneComponent>(TEXT("AssetRoot"));
 	RootComponent = AssetRoot;
+
+	MaxConcurrentMeshes = 4;
 }
 
 // Called when the game starts or when spawned
@@ -25,6 +27,11 @@ void AglTFRuntimeAssetActorAsync::BeginPlay()
 		return;
 	}
 
+	if (StaticMeshConfig.bAsyncPhysicsCooking)
+	{
+		Asset->OnStaticMeshPhysicsCooked.AddUniqueDynamic(this, &AglTFRuntimeAssetActorAsync::OnStaticMeshPhysicsCooked);
+	}
+
 	TArray<FglTFRuntimeScene> Scenes = Asset->GetScenes();
 	for (FglTFRuntimeScene& Scene : Scenes)
 	{
@@ -105,45 +112,107 @@ void AglTFRuntimeAssetActorAsync::ProcessNode(USceneComponent* NodeParentCompone
 
 void AglTFRuntimeAssetActorAsync::LoadNextMeshAsync()
 {
-	if (MeshesToLoad.Num() == 0)
+	// cached meshes complete synchronously and re-enter this function, so every request is removed from the queue before being started
+	while (MeshesToLoad.Num() > 0 && MeshesLoading.Num() < FMath::Max(MaxConcurrentMeshes, 1))
+	{
+		auto It = MeshesToLoad.CreateIterator();
+		UPrimitiveComponent* PrimitiveComponent = It->Key;
+		const FglTFRuntimeNode Node = It->Value;
+		It.RemoveCurrent();
+
+		UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest = NewObject<UglTFRuntimeAssetActorAsyncMeshRequest>(this);
+		MeshRequest->Actor = this;
+		MeshRequest->PrimitiveComponents.Add(PrimitiveComponent);
+
+		const bool bStaticMesh = PrimitiveComponent->IsA<UStaticMeshComponent>();
+		// when the mesh would be shared through the parser cache, build it once for all of the nodes using it
+		if ((bStaticMesh ? StaticMeshConfig.CacheMode : SkeletalMeshConfig.CacheMode) == EglTFRuntimeCacheMode::ReadWrite)
+		{
+			for (auto SharedIt = MeshesToLoad.CreateIterator(); SharedIt; ++SharedIt)
+			{
+				if (SharedIt->Value.MeshIndex == Node.MeshIndex && SharedIt->Value.SkinIndex == Node.SkinIndex && SharedIt->Key->IsA<UStaticMeshComponent>() == bStaticMesh)
+				{
+					MeshRequest->PrimitiveComponents.Add(SharedIt->Key);
+					SharedIt.RemoveCurrent();
+				}
+			}
+		}
+
+		MeshesLoading.Add(MeshRequest);
+
+		if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(PrimitiveComponent))
+		{
+			if (StaticMeshConfig.Outer == nullptr)
+			{
+				StaticMeshConfig.Outer = StaticMeshComponent;
+			}
+			FglTFRuntimeStaticMeshAsync Delegate;
+			Delegate.BindDynamic(MeshRequest, &UglTFRuntimeAssetActorAsyncMeshRequest::LoadStaticMeshAsync);
+			Asset->LoadStaticMeshAsync(Node.MeshIndex, Delegate, StaticMeshConfig);
+		}
+		else if (USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(PrimitiveComponent))
+		{
+			FglTFRuntimeSkeletalMeshAsync Delegate;
+			Delegate.BindDynamic(MeshRequest, &UglTFRuntimeAssetActorAsyncMeshRequest::LoadSkeletalMeshAsync);
+			Asset->LoadSkeletalMeshAsync(Node.MeshIndex, Node.SkinIndex, Delegate, SkeletalMeshConfig);
+		}
+		else
+		{
+			MeshesLoading.Remove(MeshRequest);
+		}
+	}
+}
+
+void AglTFRuntimeAssetActorAsync::OnMeshLoaded(UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest)
+{
+	MeshesLoading.Remove(MeshRequest);
+
+	LoadNextMeshAsync();
+
+	// trigger event
+	if (MeshesToLoad.Num() == 0 && MeshesLoading.Num() == 0)
+	{
+		ReceiveOnScenesLoaded();
+	}
+}
+
+void AglTFRuntimeAssetActorAsync::OnStaticMeshPhysicsCooked(UStaticMesh* StaticMesh)
+{
+	TArray<TWeakObjectPtr<UStaticMeshComponent>> StaticMeshComponents;
+	if (!StaticMeshComponentsCooking.RemoveAndCopyValue(StaticMesh, StaticMeshComponents))
 	{
 		return;
 	}
 
-	auto It = MeshesToLoad.CreateIterator();
-	if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(It->Key))
+	// the components got the mesh before its collision was ready
+	for (const TWeakObjectPtr<UStaticMeshComponent>& StaticMeshComponent : StaticMeshComponents)
 	{
-		CurrentPrimitiveComponent = StaticMeshComponent;
-		if (StaticMeshConfig.Outer == nullptr)
+		if (StaticMeshComponent.IsValid() && StaticMeshComponent->GetStaticMesh() == StaticMesh && StaticMeshComponent->IsPhysicsStateCreated())
 		{
-			StaticMeshConfig.Outer = StaticMeshComponent;
+			StaticMeshComponent->RecreatePhysicsState();
 		}
-		FglTFRuntimeStaticMeshAsync Delegate;
-		Delegate.BindDynamic(this, &AglTFRuntimeAssetActorAsync::LoadStaticMeshAsync);
-		Asset->LoadStaticMeshAsync(It->Value.MeshIndex, Delegate, StaticMeshConfig);
-	}
-	else if (USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(It->Key))
-	{
-		CurrentPrimitiveComponent = SkeletalMeshComponent;
-		FglTFRuntimeSkeletalMeshAsync Delegate;
-		Delegate.BindDynamic(this, &AglTFRuntimeAssetActorAsync::LoadSkeletalMeshAsync);
-		Asset->LoadSkeletalMeshAsync(It->Value.MeshIndex, It->Value.SkinIndex, Delegate, SkeletalMeshConfig);
 	}
 }
 
-void AglTFRuntimeAssetActorAsync::LoadStaticMeshAsync(UStaticMesh* StaticMesh)
+void UglTFRuntimeAssetActorAsyncMeshRequest::LoadStaticMeshAsync(UStaticMesh* StaticMesh)
 {
-	if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(CurrentPrimitiveComponent))
+	for (UPrimitiveComponent* PrimitiveComponent : PrimitiveComponents)
 	{
-		StaticMeshComponent->SetStaticMesh(StaticMesh);
+		UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(PrimitiveComponent);
+		if (!StaticMeshComponent)
+		{
+			continue;
+		}
 
-		if (StaticMeshConfig.Outer == nullptr)
+		StaticMeshComponent->SetStaticMesh(StaticMesh);
+		if (StaticMesh && Actor->StaticMeshConfig.bAsyncPhysicsCooking)
 		{
-			StaticMeshConfig.Outer = StaticMeshComponent;
+			Actor->StaticMeshComponentsCooking.FindOrAdd(StaticMesh).Add(StaticMeshComponent);
 		}
-		if (StaticMesh && !StaticMeshConfig.ExportOriginalPivotToSocket.IsEmpty())
+
+		if (StaticMesh && !Actor->StaticMeshConfig.ExportOriginalPivotToSocket.IsEmpty())
 		{
-			UStaticMeshSocket* DeltaSocket = StaticMesh->FindSocket(FName(StaticMeshConfig.ExportOriginalPivotToSocket));
+			UStaticMeshSocket* DeltaSocket = StaticMesh->FindSocket(FName(Actor->StaticMeshConfig.ExportOriginalPivotToSocket));
 			if (DeltaSocket)
 			{
 				FTransform NewTransform = StaticMeshComponent->GetRelativeTransform();
@@ -153,38 +222,22 @@ void AglTFRuntimeAssetActorAsync::LoadStaticMeshAsync(UStaticMesh* StaticMesh)
 				StaticMeshComponent->SetRelativeTransform(NewTransform);
 			}
 		}
-
 	}
 
-	MeshesToLoad.Remove(CurrentPrimitiveComponent);
-	if (MeshesToLoad.Num() > 0)
-	{
-		LoadNextMeshAsync();
-	}
-	// trigger event
-	else
-	{
-		ReceiveOnScenesLoaded();
-	}
+	Actor->OnMeshLoaded(this);
 }
 
-void AglTFRuntimeAssetActorAsync::LoadSkeletalMeshAsync(USkeletalMesh* SkeletalMesh)
+void UglTFRuntimeAssetActorAsyncMeshRequest::LoadSkeletalMeshAsync(USkeletalMesh* SkeletalMesh)
 {
-	if (USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(CurrentPrimitiveComponent))
+	for (UPrimitiveComponent* PrimitiveComponent : PrimitiveComponents)
 	{
-		SkeletalMeshComponent->SetSkeletalMesh(SkeletalMesh);
+		if (USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(PrimitiveComponent))
+		{
+			SkeletalMeshComponent->SetSkeletalMesh(SkeletalMesh);
+		}
 	}
 
-	MeshesToLoad.Remove(CurrentPrimitiveComponent);
-	if (MeshesToLoad.Num() > 0)
-	{
-		LoadNextMeshAsync();
-	}
-	// trigger event
-	else
-	{
-		ReceiveOnScenesLoaded();
-	}
+	Actor->OnMeshLoaded(this);
 }
 
 void AglTFRuntimeAssetActorAsync::ReceiveOnScenesLoaded_Implementation()
@@ -8,6 +8,8 @@
 #include "Misc/Base64.h"
 #include "Misc/Compression.h"
 #include "Interfaces/IPluginManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/Event.h"
 
 DEFINE_LOG_CATEGORY(LogGLTFRuntime);
 
@@ -46,14 +48,50 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromFilename(const FString& F
 		}
 	}
 
-	TArray64<uint8> Content;
-	if (!FFileHelper::LoadFileToArray(Content, *TruePath))
+	TSharedPtr<FglTFRuntimeParser> Parser = nullptr;
+
+	// metadata only mode uses the streaming reader too, so the binary chunk is never read
+	if (LoaderConfig.bStreamBinaryChunk || LoaderConfig.bMetadataOnly)
 	{
-		UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to load file %s"), *Filename);
-		return nullptr;
+		TSharedRef<FglTFRuntimeStreamingFile> StreamingFile = MakeShared<FglTFRuntimeStreamingFile>();
+		if (StreamingFile->Open(TruePath) && StreamingFile->IsBinary())
+		{
+			Parser = FromStreamingFile(StreamingFile, LoaderConfig);
+			if (Parser && LoaderConfig.bAllowExternalFiles)
+			{
+				Parser->BaseDirectory = FPaths::GetPath(TruePath);
+			}
+			return Parser;
+		}
+		// not a GLB (or unable to open it), use the standard loaders
 	}
 
-	TSharedPtr<FglTFRuntimeParser> Parser = FromData(Content.GetData(), Content.Num(), LoaderConfig);
+	TSharedPtr<FglTFRuntimeMappedFile> MappedFile = nullptr;
+	if (LoaderConfig.bUseMemoryMappedFile)
+	{
+		MappedFile = MakeShared<FglTFRuntimeMappedFile>();
+		if (!MappedFile->Map(TruePath))
+		{
+			UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to memory map file %s, falling back to regular loading"), *Filename);
+			MappedFile = nullptr;
+		}
+	}
+
+	if (MappedFile)
+	{
+		Parser = FromData(MappedFile->GetData(), MappedFile->Num(), LoaderConfig, MappedFile);
+	}
+	else
+	{
+		TArray64<uint8> Content;
+		if (!FFileHelper::LoadFileToArray(Content, *TruePath))
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to load file %s"), *Filename);
+			return nullptr;
+		}
+
+		Parser = FromData(Content.GetData(), Content.Num(), LoaderConfig);
+	}
 
 	if (Parser && LoaderConfig.bAllowExternalFiles)
 	{
@@ -64,7 +102,7 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromFilename(const FString& F
 	return Parser;
 }
 
-TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig)
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeMappedFile> InMappedFile)
 {
 	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromData, FColor::Magenta);
 
@@ -151,6 +189,8 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr
 
 		DataPtr = UncompressedData.GetData();
 		DataNum = *GzipOriginalSize;
+		// the data does not live in the mapped file anymore
+		InMappedFile = nullptr;
 	}
 
 	// Zip archive ?
@@ -198,6 +238,7 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr
 			DataPtr = UnzippedData.GetData();
 			DataNum = UnzippedData.Num();
 		}
+		InMappedFile = nullptr;
 	}
 
 	// detect binary format
@@ -208,15 +249,13 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr
 			DataPtr[2] == 0x54 &&
 			DataPtr[3] == 0x46)
 		{
-			return FromBinary(DataPtr, DataNum, LoaderConfig, ZipFile);
+			return FromBinary(DataPtr, DataNum, LoaderConfig, ZipFile, InMappedFile);
 		}
 	}
 
-	if (DataNum > 0 && DataNum <= INT32_MAX)
+	if (DataNum > 0)
 	{
-		FString JsonData;
-		FFileHelper::BufferToString(JsonData, DataPtr, (int32)DataNum);
-		return FromString(JsonData, LoaderConfig, ZipFile);
+		return FromJsonBytes(DataPtr, DataNum, LoaderConfig, ZipFile);
 	}
 
 	return nullptr;
@@ -238,7 +277,12 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromString(const FString& Jso
 	if (!JsonObject)
 		return nullptr;
 
-	TSharedPtr<FglTFRuntimeParser> Parser = MakeShared<FglTFRuntimeParser>(JsonObject.ToSharedRef(), LoaderConfig.GetMatrix(), LoaderConfig.SceneScale);
+	return FromJsonObject(JsonObject.ToSharedRef(), LoaderConfig, InZipFile);
+}
+
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromJsonObject(TSharedRef<FJsonObject> JsonObject, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile)
+{
+	TSharedPtr<FglTFRuntimeParser> Parser = MakeShared<FglTFRuntimeParser>(JsonObject, LoaderConfig.GetMatrix(), LoaderConfig.SceneScale, LoaderConfig.bMetadataOnly);
 
 	if (Parser)
 	{
@@ -255,17 +299,21 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromString(const FString& Jso
 		}
 
 		Parser->ZipFile = InZipFile;
+		Parser->DecodedAccessorsCacheMaxSize = (int64)LoaderConfig.DecodedAccessorsCacheMaxSizeMB * 1024 * 1024;
+		Parser->DecodedBufferViewsCacheMaxSize = (int64)LoaderConfig.DecodedBufferViewsCacheMaxSizeMB * 1024 * 1024;
 	}
 
 	return Parser;
 }
 
-TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile)
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile, TSharedPtr<FglTFRuntimeMappedFile> InMappedFile)
 {
 	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromBinary, FColor::Magenta);
 
-	FString JsonData;
-	TArray64<uint8> BinaryBuffer;
+	const uint8* JsonChunkPtr = nullptr;
+	int64 JsonChunkLength = 0;
+	const uint8* BinaryChunkPtr = nullptr;
+	int64 BinaryChunkLength = 0;
 
 	bool bJsonFound = false;
 	bool bBinaryFound = false;
@@ -291,13 +339,15 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(const uint8* DataP
 		if (*ChunkType == 0x4E4F534A && !bJsonFound)
 		{
 			bJsonFound = true;
-			FFileHelper::BufferToString(JsonData, &DataPtr[BlobIndex], *ChunkLength);
+			JsonChunkPtr = &DataPtr[BlobIndex];
+			JsonChunkLength = *ChunkLength;
 		}
 
 		else if (*ChunkType == 0x004E4942 && !bBinaryFound)
 		{
 			bBinaryFound = true;
-			BinaryBuffer.Append(&DataPtr[BlobIndex], *ChunkLength);
+			BinaryChunkPtr = &DataPtr[BlobIndex];
+			BinaryChunkLength = *ChunkLength;
 		}
 
 		BlobIndex += *ChunkLength;
@@ -308,23 +358,131 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(const uint8* DataP
 		return nullptr;
 	}
 
-	TSharedPtr<FglTFRuntimeParser> Parser = FromString(JsonData, LoaderConfig, InZipFile);
+	TSharedPtr<FglTFRuntimeParser> Parser = FromJsonBytes(JsonChunkPtr, JsonChunkLength, LoaderConfig, InZipFile);
 
 	if (Parser)
 	{
-		if (bBinaryFound)
+		if (bBinaryFound && !LoaderConfig.bMetadataOnly)
 		{
-			Parser->SetBinaryBuffer(BinaryBuffer);
+			if (InMappedFile)
+			{
+				// keep the mapping alive, pages will be touched only when accessors are decoded
+				Parser->MappedFile = InMappedFile;
+				Parser->MappedBinaryBuffer.Data = const_cast<uint8*>(BinaryChunkPtr);
+				Parser->MappedBinaryBuffer.Num = BinaryChunkLength;
+			}
+			else
+			{
+				Parser->BinaryBuffer.Append(BinaryChunkPtr, BinaryChunkLength);
+			}
 		}
 	}
 
 	return Parser;
 }
 
-FglTFRuntimeParser::FglTFRuntimeParser(TSharedRef<FJsonObject> JsonObject, const FMatrix& InSceneBasis, float InSceneScale) : Root(JsonObject), SceneBasis(InSceneBasis), SceneScale(InSceneScale)
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromStreamingFile(TSharedRef<FglTFRuntimeStreamingFile> InStreamingFile, const FglTFRuntimeConfig& LoaderConfig)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromStreamingFile, FColor::Magenta);
+
+	const int64 DataNum = InStreamingFile->GetFileSize();
+
+	TArray64<uint8> JsonChunk;
+	int64 BinaryChunkOffset = 0;
+	int64 BinaryChunkLength = 0;
+
+	bool bJsonFound = false;
+	bool bBinaryFound = false;
+	int64 BlobIndex = 12;
+
+	// only the chunk headers and the json chunk are read
+	while (BlobIndex < DataNum)
+	{
+		if (BlobIndex + 8 > DataNum)
+		{
+			return nullptr;
+		}
+
+		uint32 ChunkHeader[2];
+		if (!InStreamingFile->ReadRange(BlobIndex, 8, (uint8*)ChunkHeader))
+		{
+			return nullptr;
+		}
+
+		const uint32 ChunkLength = ChunkHeader[0];
+		const uint32 ChunkType = ChunkHeader[1];
+
+		BlobIndex += 8;
+
+		if ((BlobIndex + ChunkLength) > DataNum)
+		{
+			return nullptr;
+		}
+
+		if (ChunkType == 0x4E4F534A && !bJsonFound)
+		{
+			bJsonFound = true;
+			JsonChunk.AddUninitialized(ChunkLength);
+			if (!InStreamingFile->ReadRange(BlobIndex, ChunkLength, JsonChunk.GetData()))
+			{
+				return nullptr;
+			}
+		}
+
+		else if (ChunkType == 0x004E4942 && !bBinaryFound)
+		{
+			bBinaryFound = true;
+			BinaryChunkOffset = BlobIndex;
+			BinaryChunkLength = ChunkLength;
+		}
+
+		BlobIndex += ChunkLength;
+	}
+
+	if (!bJsonFound)
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FglTFRuntimeParser> Parser = FromJsonBytes(JsonChunk.GetData(), JsonChunk.Num(), LoaderConfig, nullptr);
+
+	if (Parser && bBinaryFound && !LoaderConfig.bMetadataOnly)
+	{
+		Parser->StreamingFile = InStreamingFile;
+		Parser->StreamingBinaryChunkOffset = BinaryChunkOffset;
+		Parser->StreamingBinaryChunkLength = BinaryChunkLength;
+		Parser->StreamedBufferViewsCacheMaxSize = (int64)LoaderConfig.StreamedBufferViewsCacheMaxSizeMB * 1024 * 1024;
+	}
+
+	return Parser;
+}
+
+FglTFRuntimeParser::FglTFRuntimeParser(TSharedRef<FJsonObject> JsonObject, const FMatrix& InSceneBasis, float InSceneScale, const bool bInMetadataOnly) : Root(JsonObject), SceneBasis(InSceneBasis), SceneScale(InSceneScale)
 {
 	bAllNodesCached = false;
+	StreamingBinaryChunkOffset = 0;
+	StreamingBinaryChunkLength = 0;
+	StreamedBufferViewsCacheSize = 0;
+	StreamedBufferViewsCacheMaxSize = 0;
+	bMetadataOnly = bInMetadataOnly;
+	DecodedAccessorsCacheSize = 0;
+	DecodedAccessorsCacheMaxSize = 0;
+	DecodedBufferViewsCacheSize = 0;
+	DecodedBufferViewsCacheMaxSize = 0;
+
+	// base materials and the typed document are only required for building assets
+	if (!bMetadataOnly)
+	{
+		LoadBaseMaterials();
+		BuildDocument();
+	}
 
+	JsonObject->TryGetStringArrayField("extensionsUsed", ExtensionsUsed);
+	JsonObject->TryGetStringArrayField("extensionsRequired", ExtensionsRequired);
+}
+
+void FglTFRuntimeParser::LoadBaseMaterials()
+{
 	UMaterialInterface* OpaqueMaterial = LoadObject<UMaterialInterface>(nullptr, TEXT("/glTFRuntime/M_glTFRuntimeBase"));
 	if (OpaqueMaterial)
 	{
@@ -385,13 +543,213 @@ FglTFRuntimeParser::FglTFRuntimeParser(TSharedRef<FJsonObject> JsonObject, const
 	{
 		SpecularGlossinessMaterialsMap.Add(EglTFRuntimeMaterialType::TwoSidedTranslucent, SGTwoSidedTranslucentMaterial);
 	}
+}
 
-	JsonObject->TryGetStringArrayField("extensionsUsed", ExtensionsUsed);
-	JsonObject->TryGetStringArrayField("extensionsRequired", ExtensionsRequired);
+void FglTFRuntimeParser::BuildDocument()
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_BuildDocument, FColor::Magenta);
+
+	const TArray<TSharedPtr<FJsonValue>>* JsonBufferViews;
+	if (Root->TryGetArrayField("bufferViews", JsonBufferViews))
+	{
+		BufferViewDescs.AddDefaulted(JsonBufferViews->Num());
+		for (int32 Index = 0; Index < JsonBufferViews->Num(); Index++)
+		{
+			TSharedPtr<FJsonObject> JsonBufferViewObject = (*JsonBufferViews)[Index]->AsObject();
+			if (!JsonBufferViewObject)
+			{
+				continue;
+			}
+
+			FglTFRuntimeBufferViewDesc& BufferViewDesc = BufferViewDescs[Index];
+
+			int64 BufferIndex;
+			if (!JsonBufferViewObject->TryGetNumberField("buffer", BufferIndex) || !JsonBufferViewObject->TryGetNumberField("byteLength", BufferViewDesc.ByteLength))
+			{
+				continue;
+			}
+
+			BufferViewDesc.Buffer = BufferIndex;
+			BufferViewDesc.ByteOffset = (int64)GetJsonObjectNumber(JsonBufferViewObject.ToSharedRef(), "byteOffset", 0);
+			BufferViewDesc.ByteStride = (int64)GetJsonObjectNumber(JsonBufferViewObject.ToSharedRef(), "byteStride", 0);
+
+			const TSharedPtr<FJsonObject>* JsonExtensionsObject;
+			const TSharedPtr<FJsonObject>* JsonMeshoptObject;
+			if (JsonBufferViewObject->TryGetObjectField("extensions", JsonExtensionsObject) && (*JsonExtensionsObject)->TryGetObjectField("EXT_meshopt_compression", JsonMeshoptObject))
+			{
+				int64 MeshoptBufferIndex;
+				FString MeshoptMode;
+				if (!(*JsonMeshoptObject)->TryGetNumberField("buffer", MeshoptBufferIndex) ||
+					!(*JsonMeshoptObject)->TryGetNumberField("byteLength", BufferViewDesc.MeshoptByteLength) ||
+					!(*JsonMeshoptObject)->TryGetNumberField("byteStride", BufferViewDesc.MeshoptByteStride) ||
+					!(*JsonMeshoptObject)->TryGetNumberField("count", BufferViewDesc.MeshoptCount) ||
+					!(*JsonMeshoptObject)->TryGetStringField("mode", MeshoptMode))
+				{
+					continue;
+				}
+
+				if (MeshoptMode == "ATTRIBUTES")
+				{
+					BufferViewDesc.MeshoptMode = EglTFRuntimeMeshoptMode::Attributes;
+				}
+				else if (MeshoptMode == "TRIANGLES")
+				{
+					BufferViewDesc.MeshoptMode = EglTFRuntimeMeshoptMode::Triangles;
+				}
+				else if (MeshoptMode == "INDICES")
+				{
+					BufferViewDesc.MeshoptMode = EglTFRuntimeMeshoptMode::Indices;
+				}
+				else
+				{
+					continue;
+				}
+
+				FString MeshoptFilter;
+				if ((*JsonMeshoptObject)->TryGetStringField("filter", MeshoptFilter))
+				{
+					if (MeshoptFilter == "OCTAHEDRAL")
+					{
+						BufferViewDesc.MeshoptFilter = EglTFRuntimeMeshoptFilter::Octahedral;
+					}
+					else if (MeshoptFilter == "QUATERNION")
+					{
+						BufferViewDesc.MeshoptFilter = EglTFRuntimeMeshoptFilter::Quaternion;
+					}
+					else if (MeshoptFilter == "EXPONENTIAL")
+					{
+						BufferViewDesc.MeshoptFilter = EglTFRuntimeMeshoptFilter::Exponential;
+					}
+					else if (MeshoptFilter != "NONE")
+					{
+						continue;
+					}
+				}
+
+				BufferViewDesc.MeshoptBuffer = MeshoptBufferIndex;
+				BufferViewDesc.MeshoptByteOffset = (int64)GetJsonObjectNumber(JsonMeshoptObject->ToSharedRef(), "byteOffset", 0);
+				BufferViewDesc.bMeshopt = true;
+			}
+
+			BufferViewDesc.bValid = true;
+		}
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* JsonAccessors;
+	if (Root->TryGetArrayField("accessors", JsonAccessors))
+	{
+		AccessorDescs.AddDefaulted(JsonAccessors->Num());
+		for (int32 Index = 0; Index < JsonAccessors->Num(); Index++)
+		{
+			TSharedPtr<FJsonObject> JsonAccessorObject = (*JsonAccessors)[Index]->AsObject();
+			if (!JsonAccessorObject)
+			{
+				continue;
+			}
+
+			FglTFRuntimeAccessorDesc& AccessorDesc = AccessorDescs[Index];
+
+			FString Type;
+			if (!JsonAccessorObject->TryGetNumberField("componentType", AccessorDesc.ComponentType) ||
+				!JsonAccessorObject->TryGetNumberField("count", AccessorDesc.Count) ||
+				!JsonAccessorObject->TryGetStringField("type", Type))
+			{
+				continue;
+			}
+
+			AccessorDesc.ElementSize = GetComponentTypeSize(AccessorDesc.ComponentType);
+			AccessorDesc.Elements = GetTypeSize(Type);
+			if (AccessorDesc.ElementSize == 0 || AccessorDesc.Elements == 0)
+			{
+				continue;
+			}
+
+			AccessorDesc.BufferView = GetJsonObjectIndex(JsonAccessorObject.ToSharedRef(), "bufferView", INDEX_NONE);
+			AccessorDesc.ByteOffset = (int64)GetJsonObjectNumber(JsonAccessorObject.ToSharedRef(), "byteOffset", 0);
+			AccessorDesc.bNormalized = GetJsonObjectBool(JsonAccessorObject.ToSharedRef(), "normalized", false);
+
+			const TSharedPtr<FJsonObject>* JsonSparseObject = nullptr;
+			if (JsonAccessorObject->TryGetObjectField("sparse", JsonSparseObject))
+			{
+				if (!(*JsonSparseObject)->TryGetNumberField("count", AccessorDesc.SparseCount))
+				{
+					continue;
+				}
+
+				if (AccessorDesc.SparseCount > AccessorDesc.Count || AccessorDesc.SparseCount < 1)
+				{
+					continue;
+				}
+
+				const TSharedPtr<FJsonObject>* JsonSparseIndicesObject = nullptr;
+				const TSharedPtr<FJsonObject>* JsonSparseValuesObject = nullptr;
+				// without indices or values, the sparse section does not change anything
+				if ((*JsonSparseObject)->TryGetObjectField("indices", JsonSparseIndicesObject) && (*JsonSparseObject)->TryGetObjectField("values", JsonSparseValuesObject))
+				{
+					AccessorDesc.SparseIndicesBufferView = GetJsonObjectIndex(JsonSparseIndicesObject->ToSharedRef(), "bufferView", INDEX_NONE);
+					AccessorDesc.SparseIndicesByteOffset = (int64)GetJsonObjectNumber(JsonSparseIndicesObject->ToSharedRef(), "byteOffset", 0);
+					if (AccessorDesc.SparseIndicesBufferView < 0 || !(*JsonSparseIndicesObject)->TryGetNumberField("componentType", AccessorDesc.SparseIndicesComponentType))
+					{
+						continue;
+					}
+
+					AccessorDesc.SparseValuesBufferView = GetJsonObjectIndex(JsonSparseValuesObject->ToSharedRef(), "bufferView", INDEX_NONE);
+					AccessorDesc.SparseValuesByteOffset = (int64)GetJsonObjectNumber(JsonSparseValuesObject->ToSharedRef(), "byteOffset", 0);
+					if (AccessorDesc.SparseValuesBufferView < 0)
+					{
+						continue;
+					}
+
+					AccessorDesc.bHasSparse = true;
+				}
+			}
+
+			AccessorDesc.bValid = true;
+		}
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* JsonTextures;
+	if (Root->TryGetArrayField("textures", JsonTextures))
+	{
+		TextureDescs.AddDefaulted(JsonTextures->Num());
+		for (int32 Index = 0; Index < JsonTextures->Num(); Index++)
+		{
+			TSharedPtr<FJsonObject> JsonTextureObject = (*JsonTextures)[Index]->AsObject();
+			if (!JsonTextureObject)
+			{
+				continue;
+			}
+
+			TextureDescs[Index].Source = GetJsonObjectIndex(JsonTextureObject.ToSharedRef(), "source", INDEX_NONE);
+			TextureDescs[Index].Sampler = GetJsonObjectIndex(JsonTextureObject.ToSharedRef(), "sampler", INDEX_NONE);
+		}
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* JsonSamplers;
+	if (Root->TryGetArrayField("samplers", JsonSamplers))
+	{
+		SamplerDescs.AddDefaulted(JsonSamplers->Num());
+		for (int32 Index = 0; Index < JsonSamplers->Num(); Index++)
+		{
+			TSharedPtr<FJsonObject> JsonSamplerObject = (*JsonSamplers)[Index]->AsObject();
+			if (!JsonSamplerObject)
+			{
+				continue;
+			}
+
+			SamplerDescs[Index].MinFilter = (int32)GetJsonObjectNumber(JsonSamplerObject.ToSharedRef(), "minFilter", 0);
+			SamplerDescs[Index].MagFilter = (int32)GetJsonObjectNumber(JsonSamplerObject.ToSharedRef(), "magFilter", 0);
+			SamplerDescs[Index].WrapS = (int32)GetJsonObjectNumber(JsonSamplerObject.ToSharedRef(), "wrapS", 10497);
+			SamplerDescs[Index].WrapT = (int32)GetJsonObjectNumber(JsonSamplerObject.ToSharedRef(), "wrapT", 10497);
+		}
+	}
 }
 
 bool FglTFRuntimeParser::LoadNodes()
 {
+	// the nodes cache is built once (by the first caller) and never modified after
+	FScopeLock Lock(&NodesCacheLock);
+
 	if (bAllNodesCached)
 	{
 		return true;
@@ -405,6 +763,8 @@ bool FglTFRuntimeParser::LoadNodes()
 		return false;
 	}
 
+	AllNodesCache.Empty(JsonNodes->Num());
+
 	// first round for getting all nodes
 	for (int32 Index = 0; Index < JsonNodes->Num(); Index++)
 	{
@@ -527,13 +887,24 @@ bool FglTFRuntimeParser::CheckJsonIndex(TSharedRef<FJsonObject> JsonObject, cons
 
 TSharedPtr<FJsonObject> FglTFRuntimeParser::GetJsonObjectFromIndex(TSharedRef<FJsonObject> JsonObject, const FString& FieldName, const int32 Index)
 {
-	TArray<TSharedRef<FJsonValue>> JsonArray;
-	if (!CheckJsonIndex(JsonObject, FieldName, Index, JsonArray))
+	if (Index < 0)
+	{
+		return nullptr;
+	}
+
+	// direct access, no need to copy the whole array like CheckJsonIndex does
+	const TArray<TSharedPtr<FJsonValue>>* JsonArray;
+	if (!JsonObject->TryGetArrayField(FieldName, JsonArray))
+	{
+		return nullptr;
+	}
+
+	if (Index >= JsonArray->Num())
 	{
 		return nullptr;
 	}
 
-	return JsonArray[Index]->AsObject();
+	return (*JsonArray)[Index]->AsObject();
 }
 
 TSharedPtr<FJsonObject> FglTFRuntimeParser::GetJsonObjectFromExtensionIndex(TSharedRef<FJsonObject> JsonObject, const FString& ExtensionName, const FString& FieldName, const int32 Index)
@@ -732,10 +1103,9 @@ bool FglTFRuntimeParser::LoadScene(int32 SceneIndex, FglTFRuntimeScene& Scene)
 
 bool FglTFRuntimeParser::GetAllNodes(TArray<FglTFRuntimeNode>& Nodes)
 {
-	if (!bAllNodesCached)
+	if (!LoadNodes())
 	{
-		if (!LoadNodes())
-			return false;
+		return false;
 	}
 
 	Nodes = AllNodesCache;
@@ -746,10 +1116,9 @@ bool FglTFRuntimeParser::GetAllNodes(TArray<FglTFRuntimeNode>& Nodes)
 bool FglTFRuntimeParser::LoadNode(int32 Index, FglTFRuntimeNode& Node)
 {
 	// a bit hacky, but allows zero-copy for cached values
-	if (!bAllNodesCached)
+	if (!LoadNodes())
 	{
-		if (!LoadNodes())
-			return false;
+		return false;
 	}
 
 	if (Index >= AllNodesCache.Num())
@@ -762,12 +1131,9 @@ bool FglTFRuntimeParser::LoadNode(int32 Index, FglTFRuntimeNode& Node)
 bool FglTFRuntimeParser::LoadNodeByName(const FString& Name, FglTFRuntimeNode& Node)
 {
 	// a bit hacky, but allows zero-copy for cached values
-	if (!bAllNodesCached)
+	if (!LoadNodes())
 	{
-		if (!LoadNodes())
-		{
-			return false;
-		}
+		return false;
 	}
 
 	for (FglTFRuntimeNode& NodeRef : AllNodesCache)
@@ -785,7 +1151,10 @@ bool FglTFRuntimeParser::LoadNodeByName(const FString& Name, FglTFRuntimeNode& N
 void FglTFRuntimeParser::AddError(const FString& ErrorContext, const FString& ErrorMessage)
 {
 	FString FullMessage = ErrorContext + ": " + ErrorMessage;
-	Errors.Add(FullMessage);
+	{
+		FScopeLock Lock(&ErrorsLock);
+		Errors.Add(FullMessage);
+	}
 	UE_LOG(LogGLTFRuntime, Error, TEXT("%s"), *FullMessage);
 	if (OnError.IsBound())
 	{
@@ -795,6 +1164,7 @@ void FglTFRuntimeParser::AddError(const FString& ErrorContext, const FString& Er
 
 void FglTFRuntimeParser::ClearErrors()
 {
+	FScopeLock Lock(&ErrorsLock);
 	Errors.Empty();
 }
 
@@ -1037,6 +1407,35 @@ TArray<FString> FglTFRuntimeParser::GetCamerasNames()
 	return CamerasNames;
 }
 
+TArray<FString> FglTFRuntimeParser::GetAnimationsNames()
+{
+	TArray<FString> AnimationsNames;
+	const TArray<TSharedPtr<FJsonValue>>* JsonAnimations;
+	if (!Root->TryGetArrayField("animations", JsonAnimations))
+	{
+		return AnimationsNames;
+	}
+
+	for (TSharedPtr<FJsonValue> JsonAnimation : *JsonAnimations)
+	{
+		TSharedPtr<FJsonObject> JsonAnimationObject = JsonAnimation->AsObject();
+		if (!JsonAnimationObject)
+		{
+			continue;
+		}
+
+		FString AnimationName;
+		if (!JsonAnimationObject->TryGetStringField("name", AnimationName))
+		{
+			continue;
+		}
+
+		AnimationsNames.Add(AnimationName);
+	}
+
+	return AnimationsNames;
+}
+
 UglTFRuntimeAnimationCurve* FglTFRuntimeParser::LoadNodeAnimationCurve(const int32 NodeIndex)
 {
 	FglTFRuntimeNode Node;
@@ -1376,6 +1775,9 @@ USkeleton* FglTFRuntimeParser::LoadSkeleton(const int32 SkinIndex, const FglTFRu
 		return nullptr;
 	}
 
+	// held until the skeleton is cached, so concurrent loads of the same skin build it only once
+	FScopeLock SkeletonsScopeLock(&SkeletonsCacheLock);
+
 	if (CanReadFromCache(SkeletonConfig.CacheMode) && SkeletonsCache.Contains(SkinIndex))
 	{
 		return SkeletonsCache[SkinIndex];
@@ -1598,10 +2000,11 @@ bool FglTFRuntimeParser::FillReferenceSkeleton(TSharedRef<FJsonObject> JsonSkinO
 	int64 inverseBindMatricesIndex;
 	if (JsonSkinObject->TryGetNumberField("inverseBindMatrices", inverseBindMatricesIndex))
 	{
-		TArray64<uint8> InverseBindMatricesBytes;
+		FglTFRuntimeBlob InverseBindMatricesBlob;
+		TArray64<uint8> InverseBindMatricesAdditionalBufferView;
 		int64 ComponentType, Stride, Elements, ElementSize, Count;
 		bool bNormalized = false;
-		if (!GetAccessor(inverseBindMatricesIndex, ComponentType, Stride, Elements, ElementSize, Count, bNormalized, InverseBindMatricesBytes))
+		if (!GetAccessor(inverseBindMatricesIndex, ComponentType, Stride, Elements, ElementSize, Count, bNormalized, InverseBindMatricesBlob, InverseBindMatricesAdditionalBufferView))
 		{
 			AddError("FillReferenceSkeleton()", FString::Printf(TEXT("Unable to load accessor: %lld."), inverseBindMatricesIndex));
 			return false;
@@ -1615,7 +2018,7 @@ bool FglTFRuntimeParser::FillReferenceSkeleton(TSharedRef<FJsonObject> JsonSkinO
 			FMatrix Matrix;
 			int64 MatrixIndex = i * Stride;
 
-			float* MatrixCell = (float*)&InverseBindMatricesBytes[MatrixIndex];
+			float* MatrixCell = (float*)(InverseBindMatricesBlob.Data + MatrixIndex);
 
 			for (int32 j = 0; j < 16; j++)
 			{
@@ -1855,8 +2258,11 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		SupportedTexCoordComponentTypes.Append({ 5120, 5122 });
 	}
 
-	if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "POSITION", Primitive.Positions,
-		{ 3 }, SupportedPositionComponentTypes, false, [&](FVector Value) -> FVector {return SceneBasis.TransformPosition(Value) * SceneScale; }))
+	const FglTFRuntimeAccessorTransform PositionTransform(SceneBasis, SceneScale, true);
+	const FglTFRuntimeAccessorTransform VectorTransform(SceneBasis, 1, false);
+
+	if (!BuildTransformedFromAccessorField(JsonAttributesObject->ToSharedRef(), "POSITION", Primitive.Positions,
+		{ 3 }, SupportedPositionComponentTypes, false, &PositionTransform))
 	{
 		AddError("LoadPrimitive()", "Unable to load POSITION attribute");
 		return false;
@@ -1864,8 +2270,8 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 
 	if ((*JsonAttributesObject)->HasField("NORMAL"))
 	{
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "NORMAL", Primitive.Normals,
-			{ 3 }, SupportedNormalComponentTypes, false, [&](FVector Value) -> FVector { return SceneBasis.TransformVector(Value); }))
+		if (!BuildTransformedFromAccessorField(JsonAttributesObject->ToSharedRef(), "NORMAL", Primitive.Normals,
+			{ 3 }, SupportedNormalComponentTypes, false, &VectorTransform))
 		{
 			AddError("LoadPrimitive()", "Unable to load NORMAL attribute");
 			return false;
@@ -1874,8 +2280,8 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 
 	if ((*JsonAttributesObject)->HasField("TANGENT"))
 	{
-		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "TANGENT", Primitive.Tangents,
-			{ 4 }, SupportedTangentComponentTypes, false, [&](FVector4 Value) -> FVector4 { return SceneBasis.TransformFVector4(Value); }))
+		if (!BuildTransformedFromAccessorField(JsonAttributesObject->ToSharedRef(), "TANGENT", Primitive.Tangents,
+			{ 4 }, SupportedTangentComponentTypes, false, &VectorTransform))
 		{
 			AddError("LoadPrimitive()", "Unable to load TANGENT attribute");
 			return false;
@@ -1986,8 +2392,8 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 
 			if (JsonTargetObject->HasField("POSITION"))
 			{
-				if (!BuildFromAccessorField(JsonTargetObject.ToSharedRef(), "POSITION", MorphTarget.Positions,
-					{ 3 }, { 5126 }, false, [&](FVector Value) -> FVector { return SceneBasis.TransformPosition(Value) * SceneScale; }))
+				if (!BuildTransformedFromAccessorField(JsonTargetObject.ToSharedRef(), "POSITION", MorphTarget.Positions,
+					{ 3 }, { 5126 }, false, &PositionTransform))
 				{
 					AddError("LoadPrimitive()", "Unable to load POSITION attribute for MorphTarget");
 					return false;
@@ -2002,8 +2408,8 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 
 			if (JsonTargetObject->HasField("NORMAL"))
 			{
-				if (!BuildFromAccessorField(JsonTargetObject.ToSharedRef(), "NORMAL", MorphTarget.Normals,
-					{ 3 }, { 5126 }, false, [&](FVector Value) -> FVector { return SceneBasis.TransformVector(Value); }))
+				if (!BuildTransformedFromAccessorField(JsonTargetObject.ToSharedRef(), "NORMAL", MorphTarget.Normals,
+					{ 3 }, { 5126 }, false, &VectorTransform))
 				{
 					AddError("LoadPrimitive()", "Unable to load NORMAL attribute for MorphTarget");
 					return false;
@@ -2026,10 +2432,11 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 	int64 IndicesAccessorIndex;
 	if (JsonPrimitiveObject->TryGetNumberField("indices", IndicesAccessorIndex))
 	{
-		TArray64<uint8> IndicesBytes;
+		FglTFRuntimeBlob IndicesBlob;
+		TArray64<uint8> IndicesAdditionalBufferView;
 		int64 ComponentType, Stride, Elements, ElementSize, Count;
 		bool bNormalized = false;
-		if (!GetAccessor(IndicesAccessorIndex, ComponentType, Stride, Elements, ElementSize, Count, bNormalized, IndicesBytes))
+		if (!GetAccessor(IndicesAccessorIndex, ComponentType, Stride, Elements, ElementSize, Count, bNormalized, IndicesBlob, IndicesAdditionalBufferView))
 		{
 			AddError("LoadPrimitive()", FString::Printf(TEXT("Unable to load accessor: %lld"), IndicesAccessorIndex));
 			return false;
@@ -2040,49 +2447,30 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 			return false;
 		}
 
-		if (IndicesBytes.Num() < (Count * Stride))
+		if (Count > 0 && IndicesBlob.Num < (Count - 1) * Stride + ElementSize)
 		{
-			AddError("LoadPrimitive()", FString::Printf(TEXT("Invalid size for accessor indices: %lld"), IndicesBytes.Num()));
+			AddError("LoadPrimitive()", FString::Printf(TEXT("Invalid size for accessor indices: %lld"), IndicesBlob.Num));
 			return false;
 		}
 
-		for (int64 i = 0; i < Count; i++)
+		Primitive.Indices.AddUninitialized(Count);
+		if (!FglTFRuntimeAccessorKernels::DecodeIndices(ComponentType, IndicesBlob.Data, Stride, Count, Primitive.Indices.GetData()))
 		{
-			int64 IndexIndex = i * Stride;
-
-			uint32 VertexIndex;
-			if (ComponentType == 5121)
-			{
-				VertexIndex = IndicesBytes[IndexIndex];
-			}
-			else if (ComponentType == 5123)
-			{
-				uint16* IndexPtr = (uint16*)&(IndicesBytes[IndexIndex]);
-				VertexIndex = *IndexPtr;
-			}
-			else if (ComponentType == 5125)
-			{
-				uint32* IndexPtr = (uint32*)&(IndicesBytes[IndexIndex]);
-				VertexIndex = *IndexPtr;
-			}
-			else
-			{
-				AddError("LoadPrimitive()", FString::Printf(TEXT("Invalid component type for indices: %lld"), ComponentType));
-				return false;
-			}
-
-			Primitive.Indices.Add(VertexIndex);
+			AddError("LoadPrimitive()", FString::Printf(TEXT("Invalid component type for indices: %lld"), ComponentType));
+			return false;
 		}
 	}
 	else
 	{
+		Primitive.Indices.AddUninitialized(Primitive.Positions.Num());
 		for (int32 VertexIndex = 0; VertexIndex < Primitive.Positions.Num(); VertexIndex++)
 		{
-			Primitive.Indices.Add(VertexIndex);
+			Primitive.Indices[VertexIndex] = VertexIndex;
 		}
+		Primitive.bHasSynthesizedIndices = true;
 	}
 
-	// Draco decompression
+	// Draco compressed primitives
 	const TSharedPtr<FJsonObject>* JsonExtensions;
 	if (JsonPrimitiveObject->TryGetObjectField("extensions", JsonExtensions))
 	{
@@ -2097,16 +2485,13 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 				return false;
 			}
 
-			TArray64<uint8> DracoData;
-			int64 Stride;
-			if (!GetBufferView(BufferView, DracoData, Stride))
+			// the compressed stream cannot be decoded, but an optional extension comes with the uncompressed accessors already loaded above
+			TSharedPtr<FJsonObject> JsonPositionAccessorObject = GetJsonObjectFromRootIndex("accessors", (*JsonAttributesObject)->GetIntegerField("POSITION"));
+			if (ExtensionsRequired.Contains("KHR_draco_mesh_compression") || !JsonPositionAccessorObject || !JsonPositionAccessorObject->HasField("bufferView"))
 			{
-				AddError("LoadPrimitive()", "KHR_draco_mesh_compression has an invalid bufferView");
+				AddError("LoadPrimitive()", "KHR_draco_mesh_compression extension is currently not supported");
 				return false;
 			}
-
-			AddError("LoadPrimitive()", "KHR_draco_mesh_compression extension is currently not supported");
-			return false;
 		}
 	}
 
@@ -2119,6 +2504,11 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 			AddError("LoadPrimitive()", FString::Printf(TEXT("Unable to load material %lld"), MaterialIndex));
 			return false;
 		}
+
+		// an overriding material can sample normal maps the glTF material does not declare
+		const bool bOverridden = MaterialsConfig.MaterialsOverrideMap.Contains(static_cast<int32>(MaterialIndex)) || MaterialsConfig.MaterialsOverrideByNameMap.Contains(Primitive.MaterialName) || MaterialsConfig.UberMaterialsOverrideMap.Num() > 0;
+		TSharedPtr<FJsonObject> JsonMaterialObject = GetJsonObjectFromRootIndex("materials", MaterialIndex);
+		Primitive.bHasNormalTexture = bOverridden || (JsonMaterialObject && JsonMaterialObject->HasField("normalTexture"));
 	}
 	else
 	{
@@ -2130,20 +2520,56 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 
 
 bool FglTFRuntimeParser::GetBuffer(int32 Index, TArray64<uint8>& Bytes)
+{
+	FglTFRuntimeBlob Blob;
+	if (!GetBuffer(Index, Blob))
+	{
+		return false;
+	}
+
+	Bytes.Append(Blob.Data, Blob.Num);
+	return true;
+}
+
+bool FglTFRuntimeParser::GetBuffer(int32 Index, FglTFRuntimeBlob& Blob)
 {
 	if (Index < 0)
 		return false;
 
+	if (bMetadataOnly)
+	{
+		AddError("GetBuffer()", "Buffers cannot be loaded in metadata only mode");
+		return false;
+	}
+
 	if (Index == 0 && BinaryBuffer.Num() > 0)
 	{
-		Bytes = BinaryBuffer;
+		Blob.Data = BinaryBuffer.GetData();
+		Blob.Num = BinaryBuffer.Num();
 		return true;
 	}
 
+	if (Index == 0 && MappedFile)
+	{
+		Blob = MappedBinaryBuffer;
+		return true;
+	}
+
+	// streamed GLB, loading the whole binary chunk would defeat streaming (use bufferViews instead)
+	if (Index == 0 && StreamingFile)
+	{
+		AddError("GetBuffer()", "The binary chunk of a streamed GLB cannot be loaded as a whole, access it by bufferView");
+		return false;
+	}
+
+	// the lock is held while loading, so concurrent requests for the same buffer load it only once
+	FScopeLock BuffersCacheScopeLock(&BuffersCacheLock);
+
 	// first check cache
-	if (BuffersCache.Contains(Index))
+	if (TArray64<uint8>* CachedBuffer = BuffersCache.Find(Index))
 	{
-		Bytes = BuffersCache[Index];
+		Blob.Data = CachedBuffer->GetData();
+		Blob.Num = CachedBuffer->Num();
 		return true;
 	}
 
@@ -2174,38 +2600,41 @@ bool FglTFRuntimeParser::GetBuffer(int32 Index, TArray64<uint8>& Bytes)
 		return false;
 	}
 
+	TArray64<uint8> Bytes;
+	bool bLoaded = false;
+
 	// check it is a valid base64 data uri
 	if (Uri.StartsWith("data:"))
 	{
-		if (ParseBase64Uri(Uri, Bytes))
+		if (!ParseBase64Uri(Uri, Bytes))
 		{
-			BuffersCache.Add(Index, Bytes);
-			return true;
+			return false;
 		}
-		return false;
+		bLoaded = true;
 	}
 
-	if (ZipFile)
+	if (!bLoaded && ZipFile)
 	{
-		if (ZipFile->GetFileContent(Uri, Bytes))
-		{
-			BuffersCache.Add(Index, Bytes);
-			return true;
-		}
+		bLoaded = ZipFile->GetFileContent(Uri, Bytes);
 	}
 
 	// fallback
-	if (!BaseDirectory.IsEmpty())
+	if (!bLoaded && !BaseDirectory.IsEmpty())
 	{
-		if (FFileHelper::LoadFileToArray(Bytes, *FPaths::Combine(BaseDirectory, Uri)))
-		{
-			BuffersCache.Add(Index, Bytes);
-			return true;
-		}
+		bLoaded = FFileHelper::LoadFileToArray(Bytes, *FPaths::Combine(BaseDirectory, Uri));
 	}
 
-	AddError("GetBuffer()", FString::Printf(TEXT("Unable to load buffer %d from Uri %s (you may want to enable external files loading...)"), Index, *Uri));
-	return false;
+	if (!bLoaded)
+	{
+		AddError("GetBuffer()", FString::Printf(TEXT("Unable to load buffer %d from Uri %s (you may want to enable external files loading...)"), Index, *Uri));
+		return false;
+	}
+
+	// the cache owns the bytes, the heap allocation is never moved, so blobs stay valid for the parser lifetime
+	TArray64<uint8>& CachedBuffer = BuffersCache.Add(Index, MoveTemp(Bytes));
+	Blob.Data = CachedBuffer.GetData();
+	Blob.Num = CachedBuffer.Num();
+	return true;
 }
 
 bool FglTFRuntimeParser::ParseBase64Uri(const FString& Uri, TArray64<uint8>& Bytes)
@@ -2231,220 +2660,218 @@ bool FglTFRuntimeParser::ParseBase64Uri(const FString& Uri, TArray64<uint8>& Byt
 
 bool FglTFRuntimeParser::GetBufferView(int32 Index, TArray64<uint8>& Bytes, int64& Stride)
 {
-	if (Index < 0)
+	FglTFRuntimeBlob Blob;
+	if (!GetBufferView(Index, Blob, Stride))
 	{
 		return false;
 	}
 
-	const TArray<TSharedPtr<FJsonValue>>* JsonBufferViews;
+	Bytes.Append(Blob.Data, Blob.Num);
+	return true;
+}
 
-	// no bufferViews ?
-	if (!Root->TryGetArrayField("bufferViews", JsonBufferViews))
+bool FglTFRuntimeParser::GetBufferView(int32 Index, FglTFRuntimeBlob& Blob, int64& Stride)
+{
+	if (Index < 0)
 	{
 		return false;
 	}
 
-	if (Index >= JsonBufferViews->Num())
+	if (!BufferViewDescs.IsValidIndex(Index) || !BufferViewDescs[Index].bValid)
 	{
 		return false;
 	}
 
-	TSharedPtr<FJsonObject> JsonBufferObject = (*JsonBufferViews)[Index]->AsObject();
-	if (!JsonBufferObject)
-	{
-		return false;
-	}
+	const FglTFRuntimeBufferViewDesc& BufferViewDesc = BufferViewDescs[Index];
 
+	const int32 BufferIndex = BufferViewDesc.Buffer;
+	const int64 ByteLength = BufferViewDesc.ByteLength;
+	const int64 ByteOffset = BufferViewDesc.ByteOffset;
+	Stride = BufferViewDesc.ByteStride;
 
-	int64 BufferIndex;
-	if (!JsonBufferObject->TryGetNumberField("buffer", BufferIndex))
+	if (BufferViewDesc.bMeshopt)
 	{
-		return false;
+		return DecodeMeshoptBufferView(Index, Blob);
 	}
 
-	TArray64<uint8> WholeData;
-	if (!GetBuffer(BufferIndex, WholeData))
+	// streamed GLB, read only the required range
+	if (BufferIndex == 0 && StreamingFile)
 	{
-		return false;
-	}
+		if (ByteOffset < 0 || ByteLength < 0 || ByteOffset + ByteLength > StreamingBinaryChunkLength)
+		{
+			return false;
+		}
 
-	int64 ByteLength;
-	if (!JsonBufferObject->TryGetNumberField("byteLength", ByteLength))
-	{
-		return false;
-	}
+		FScopeLock StreamingScopeLock(&StreamingLock);
 
-	int64 ByteOffset;
-	if (!JsonBufferObject->TryGetNumberField("byteOffset", ByteOffset))
-	{
-		ByteOffset = 0;
+		if (TSharedPtr<TArray64<uint8>, ESPMode::ThreadSafe>* CachedBufferView = StreamedBufferViewsCache.Find(Index))
+		{
+			StreamedBufferViewsLRU.RemoveSingle(Index);
+			StreamedBufferViewsLRU.Add(Index);
+			Blob.Owner = *CachedBufferView;
+			Blob.Data = Blob.Owner->GetData();
+			Blob.Num = Blob.Owner->Num();
+			return true;
+		}
+
+		TSharedPtr<TArray64<uint8>, ESPMode::ThreadSafe> Bytes = MakeShared<TArray64<uint8>, ESPMode::ThreadSafe>();
+		Bytes->AddUninitialized(ByteLength);
+		if (!StreamingFile->ReadRange(StreamingBinaryChunkOffset + ByteOffset, ByteLength, Bytes->GetData()))
+		{
+			AddError("GetBufferView()", FString::Printf(TEXT("Unable to read bufferView %d from file"), Index));
+			return false;
+		}
+
+		// evicted entries stay alive until the last blob referencing them is released
+		if (ByteLength <= StreamedBufferViewsCacheMaxSize)
+		{
+			while (StreamedBufferViewsCacheSize + ByteLength > StreamedBufferViewsCacheMaxSize && StreamedBufferViewsLRU.Num() > 0)
+			{
+				TSharedPtr<TArray64<uint8>, ESPMode::ThreadSafe> EvictedBufferView;
+				StreamedBufferViewsCache.RemoveAndCopyValue(StreamedBufferViewsLRU[0], EvictedBufferView);
+				StreamedBufferViewsCacheSize -= EvictedBufferView->Num();
+				StreamedBufferViewsLRU.RemoveAt(0);
+			}
+			StreamedBufferViewsCache.Add(Index, Bytes);
+			StreamedBufferViewsLRU.Add(Index);
+			StreamedBufferViewsCacheSize += ByteLength;
+		}
+
+		Blob.Owner = Bytes;
+		Blob.Data = Bytes->GetData();
+		Blob.Num = Bytes->Num();
+		return true;
 	}
 
-	if (!JsonBufferObject->TryGetNumberField("byteStride", Stride))
+	FglTFRuntimeBlob WholeData;
+	if (!GetBuffer(BufferIndex, WholeData))
 	{
-		Stride = 0;
+		return false;
 	}
 
-	if (ByteOffset + ByteLength > WholeData.Num())
+	if (ByteOffset < 0 || ByteLength < 0 || ByteOffset + ByteLength > WholeData.Num)
 	{
 		return false;
 	}
 
-	Bytes.Append(&WholeData[ByteOffset], ByteLength);
+	Blob.Data = WholeData.Data + ByteOffset;
+	Blob.Num = ByteLength;
 	return true;
 }
 
 bool FglTFRuntimeParser::GetAccessor(int32 Index, int64& ComponentType, int64& Stride, int64& Elements, int64& ElementSize, int64& Count, bool& bNormalized, TArray64<uint8>& Bytes)
 {
-
-	TSharedPtr<FJsonObject> JsonAccessorObject = GetJsonObjectFromRootIndex("accessors", Index);
-	if (!JsonAccessorObject)
+	FglTFRuntimeBlob Blob;
+	TArray64<uint8> AdditionalBufferView;
+	if (!GetAccessor(Index, ComponentType, Stride, Elements, ElementSize, Count, bNormalized, Blob, AdditionalBufferView))
 	{
 		return false;
 	}
 
-	bool bInitWithZeros = false;
-	bool bHasSparse = false;
-
-	int64 BufferViewIndex;
-	if (!JsonAccessorObject->TryGetNumberField("bufferView", BufferViewIndex))
+	if (Blob.Data == AdditionalBufferView.GetData())
 	{
-		bInitWithZeros = true;
+		Bytes = MoveTemp(AdditionalBufferView);
 	}
-
-	const TSharedPtr<FJsonObject>* JsonSparseObject = nullptr;
-	if (JsonAccessorObject->TryGetObjectField("sparse", JsonSparseObject))
-	{
-		bHasSparse = true;
-	}
-
-	int64 ByteOffset;
-	if (!JsonAccessorObject->TryGetNumberField("byteOffset", ByteOffset))
-	{
-		ByteOffset = 0;
-	}
-
-	if (!JsonAccessorObject->TryGetBoolField("normalized", bNormalized))
+	else
 	{
-		bNormalized = false;
+		Bytes.Append(Blob.Data, Blob.Num);
 	}
+	return true;
+}
 
-	if (!JsonAccessorObject->TryGetNumberField("componentType", ComponentType))
+bool FglTFRuntimeParser::GetAccessor(int32 Index, int64& ComponentType, int64& Stride, int64& Elements, int64& ElementSize, int64& Count, bool& bNormalized, FglTFRuntimeBlob& Blob, TArray64<uint8>& AdditionalBufferView)
+{
+	if (!AccessorDescs.IsValidIndex(Index) || !AccessorDescs[Index].bValid)
 	{
 		return false;
 	}
 
-	if (!JsonAccessorObject->TryGetNumberField("count", Count))
-	{
-		return false;
-	}
+	const FglTFRuntimeAccessorDesc& AccessorDesc = AccessorDescs[Index];
 
-	FString Type;
-	if (!JsonAccessorObject->TryGetStringField("type", Type))
-	{
-		return false;
-	}
+	const bool bInitWithZeros = AccessorDesc.BufferView == INDEX_NONE;
+	const bool bHasSparse = AccessorDesc.bHasSparse;
+	const int32 BufferViewIndex = AccessorDesc.BufferView;
+	const int64 ByteOffset = AccessorDesc.ByteOffset;
 
-	ElementSize = GetComponentTypeSize(ComponentType);
-	if (ElementSize == 0)
-	{
-		return false;
-	}
+	bNormalized = AccessorDesc.bNormalized;
+	ComponentType = AccessorDesc.ComponentType;
+	Count = AccessorDesc.Count;
+	ElementSize = AccessorDesc.ElementSize;
+	Elements = AccessorDesc.Elements;
 
-	Elements = GetTypeSize(Type);
-	if (Elements == 0)
+	if (Count < 0 || ByteOffset < 0)
 	{
 		return false;
 	}
 
-	uint64 FinalSize = ElementSize * Elements * Count;
+	const int64 PackedSize = ElementSize * Elements;
 
 	if (bInitWithZeros)
 	{
-		Bytes.AddZeroed(FinalSize);
+		AdditionalBufferView.SetNumZeroed(PackedSize * Count);
+		Blob.Data = AdditionalBufferView.GetData();
+		Blob.Num = AdditionalBufferView.Num();
+		Stride = PackedSize;
 		if (!bHasSparse)
 		{
-			Stride = ElementSize * Elements;
 			return true;
 		}
 	}
 	else
 	{
-		if (!GetBufferView(BufferViewIndex, Bytes, Stride))
+		FglTFRuntimeBlob BufferViewBlob;
+		if (!GetBufferView(BufferViewIndex, BufferViewBlob, Stride))
 		{
 			return false;
 		}
 
 		if (Stride == 0)
 		{
-			Stride = ElementSize * Elements;
+			Stride = PackedSize;
 		}
 
-		FinalSize = Stride * Count;
+		// the last element does not need the whole stride
+		const int64 FinalSize = Count > 0 ? Stride * (Count - 1) + PackedSize : 0;
 
-		if (FinalSize > (uint64)Bytes.Num())
+		if (ByteOffset + FinalSize > BufferViewBlob.Num)
 		{
 			return false;
 		}
 
-		if (ByteOffset > 0)
-		{
-			TArray64<uint8> OffsetBytes;
-			if (Stride > ElementSize * Elements)
-			{
-				OffsetBytes.Append(&Bytes[ByteOffset], FinalSize - (Stride - (ElementSize * Elements)));
-			}
-			else
-			{
-				OffsetBytes.Append(&Bytes[ByteOffset], FinalSize);
-			}
-			Bytes = OffsetBytes;
-		}
+		Blob.Data = BufferViewBlob.Data + ByteOffset;
+		Blob.Num = FinalSize;
+		Blob.Owner = BufferViewBlob.Owner;
 
 		if (!bHasSparse)
 		{
 			return true;
 		}
-	}
 
-	int64 SparseCount;
-	if (!(*JsonSparseObject)->TryGetNumberField("count", SparseCount))
-	{
-		return false;
-	}
-
-	if (((uint64)SparseCount > FinalSize) || (SparseCount < 1))
-	{
-		return false;
-	}
-
-	const TSharedPtr<FJsonObject>* JsonSparseIndicesObject = nullptr;
-	if (!(*JsonSparseObject)->TryGetObjectField("indices", JsonSparseIndicesObject))
-	{
-		return true;
-	}
-
-	int32 SparseBufferViewIndex = GetJsonObjectIndex(JsonSparseIndicesObject->ToSharedRef(), "bufferView", INDEX_NONE);
-	if (SparseBufferViewIndex < 0)
-	{
-		return false;
-	}
-
-	int64 SparseByteOffset;
-	if (!(*JsonSparseIndicesObject)->TryGetNumberField("byteOffset", SparseByteOffset))
-	{
-		SparseByteOffset = 0;
+		// sparse accessors need a writable copy, pack it to save memory
+		AdditionalBufferView.AddUninitialized(PackedSize * Count);
+		if (Stride == PackedSize)
+		{
+			FMemory::Memcpy(AdditionalBufferView.GetData(), Blob.Data, AdditionalBufferView.Num());
+		}
+		else
+		{
+			for (int64 ElementIndex = 0; ElementIndex < Count; ElementIndex++)
+			{
+				FMemory::Memcpy(AdditionalBufferView.GetData() + ElementIndex * PackedSize, Blob.Data + ElementIndex * Stride, PackedSize);
+			}
+		}
+		Blob.Data = AdditionalBufferView.GetData();
+		Blob.Num = AdditionalBufferView.Num();
+		Stride = PackedSize;
 	}
 
-	int64 SparseComponentType;
-	if (!(*JsonSparseIndicesObject)->TryGetNumberField("componentType", SparseComponentType))
-	{
-		return false;
-	}
+	const int64 SparseCount = AccessorDesc.SparseCount;
+	const int64 SparseByteOffset = AccessorDesc.SparseIndicesByteOffset;
+	const int64 SparseComponentType = AccessorDesc.SparseIndicesComponentType;
 
-	TArray64<uint8> SparseBytesIndices;
+	FglTFRuntimeBlob SparseBytesIndices;
 	int64 SparseBufferViewIndicesStride;
-	if (!GetBufferView(SparseBufferViewIndex, SparseBytesIndices, SparseBufferViewIndicesStride))
+	if (!GetBufferView(AccessorDesc.SparseIndicesBufferView, SparseBytesIndices, SparseBufferViewIndicesStride))
 	{
 		return false;
 	}
@@ -2452,17 +2879,20 @@ bool FglTFRuntimeParser::GetAccessor(int32 Index, int64& ComponentType, int64& S
 	if (SparseBufferViewIndicesStride == 0)
 	{
 		SparseBufferViewIndicesStride = GetComponentTypeSize(SparseComponentType);
+		if (SparseBufferViewIndicesStride == 0)
+		{
+			return false;
+		}
 	}
 
-
-	if (((SparseBytesIndices.Num() - SparseByteOffset) / SparseBufferViewIndicesStride) < SparseCount)
+	if (SparseByteOffset < 0 || ((SparseBytesIndices.Num - SparseByteOffset) / SparseBufferViewIndicesStride) < SparseCount)
 	{
 		return false;
 	}
 
 	TArray<uint32> SparseIndices;
-	uint8* SparseIndicesBase = &SparseBytesIndices[SparseByteOffset];
-
+	SparseIndices.Reserve(SparseCount);
+	const uint8* SparseIndicesBase = SparseBytesIndices.Data + SparseByteOffset;
 
 	for (int32 SparseIndexOffset = 0; SparseIndexOffset < SparseCount; SparseIndexOffset++)
 	{
@@ -2474,13 +2904,13 @@ bool FglTFRuntimeParser::GetAccessor(int32 Index, int64& ComponentType, int64& S
 		// UNSIGNED_SHORT
 		else if (SparseComponentType == 5123)
 		{
-			uint16* SparseIndicesBaseUint16 = (uint16*)SparseIndicesBase;
+			const uint16* SparseIndicesBaseUint16 = (const uint16*)SparseIndicesBase;
 			SparseIndices.Add(*SparseIndicesBaseUint16);
 		}
 		// UNSIGNED_INT
 		else if (SparseComponentType == 5125)
 		{
-			uint32* SparseIndicesBaseUint32 = (uint32*)SparseIndicesBase;
+			const uint32* SparseIndicesBaseUint32 = (const uint32*)SparseIndicesBase;
 			SparseIndices.Add(*SparseIndicesBaseUint32);
 		}
 		else
@@ -2490,49 +2920,38 @@ bool FglTFRuntimeParser::GetAccessor(int32 Index, int64& ComponentType, int64& S
 		SparseIndicesBase += SparseBufferViewIndicesStride;
 	}
 
-	const TSharedPtr<FJsonObject>* JsonSparseValuesObject = nullptr;
-	if (!(*JsonSparseObject)->TryGetObjectField("values", JsonSparseValuesObject))
-	{
-		return true;
-	}
+	const int64 SparseValueByteOffset = AccessorDesc.SparseValuesByteOffset;
 
-	int32 SparseValueBufferViewIndex = GetJsonObjectIndex(JsonSparseValuesObject->ToSharedRef(), "bufferView", INDEX_NONE);
-	if (SparseValueBufferViewIndex < 0)
+	FglTFRuntimeBlob SparseBytesValues;
+	int64 SparseBufferViewValuesStride;
+	if (!GetBufferView(AccessorDesc.SparseValuesBufferView, SparseBytesValues, SparseBufferViewValuesStride))
 	{
 		return false;
 	}
 
-	int64 SparseValueByteOffset;
-	if (!(*JsonSparseValuesObject)->TryGetNumberField("byteOffset", SparseValueByteOffset))
+	if (SparseBufferViewValuesStride == 0)
 	{
-		SparseValueByteOffset = 0;
+		SparseBufferViewValuesStride = PackedSize;
 	}
 
-	TArray64<uint8> SparseBytesValues;
-	int64 SparseBufferViewValuesStride;
-	if (!GetBufferView(SparseValueBufferViewIndex, SparseBytesValues, SparseBufferViewValuesStride))
+	if (SparseValueByteOffset < 0 || SparseValueByteOffset + SparseBufferViewValuesStride * (SparseCount - 1) + PackedSize > SparseBytesValues.Num)
 	{
 		return false;
 	}
 
-	if (SparseBufferViewValuesStride == 0)
-	{
-		SparseBufferViewValuesStride = ElementSize * Elements;
-	}
-
-	Stride = SparseBufferViewValuesStride;
+	const uint8* SparseValuesBase = SparseBytesValues.Data + SparseValueByteOffset;
 
 	for (int32 IndexToChange = 0; IndexToChange < SparseCount; IndexToChange++)
 	{
 		uint32 SparseIndexToChange = SparseIndices[IndexToChange];
-		if (SparseIndexToChange >= (Bytes.Num() / Stride))
+		if (SparseIndexToChange >= Count)
 		{
 			return false;
 		}
 
-		uint8* OriginalValuePtr = (uint8*)(Bytes.GetData() + Stride * SparseIndexToChange);
-		uint8* NewValuePtr = (uint8*)(SparseBytesValues.GetData() + SparseBufferViewValuesStride * IndexToChange);
-		FMemory::Memcpy(OriginalValuePtr, NewValuePtr, SparseBufferViewValuesStride);
+		uint8* OriginalValuePtr = AdditionalBufferView.GetData() + Stride * SparseIndexToChange;
+		const uint8* NewValuePtr = SparseValuesBase + SparseBufferViewValuesStride * IndexToChange;
+		FMemory::Memcpy(OriginalValuePtr, NewValuePtr, PackedSize);
 	}
 
 	return true;
@@ -2584,10 +3003,19 @@ int64 FglTFRuntimeParser::GetTypeSize(const FString& Type) const
 void FglTFRuntimeParser::AddReferencedObjects(FReferenceCollector& Collector)
 {
 	Collector.AddReferencedObjects(StaticMeshesCache);
-	Collector.AddReferencedObjects(MaterialsCache);
-	Collector.AddReferencedObjects(SkeletonsCache);
+	{
+		FScopeLock Lock(&MaterialsCacheLock);
+		Collector.AddReferencedObjects(MaterialsCache);
+	}
+	{
+		FScopeLock Lock(&SkeletonsCacheLock);
+		Collector.AddReferencedObjects(SkeletonsCache);
+	}
 	Collector.AddReferencedObjects(SkeletalMeshesCache);
-	Collector.AddReferencedObjects(TexturesCache);
+	{
+		FScopeLock Lock(&TexturesCacheLock);
+		Collector.AddReferencedObjects(TexturesCache);
+	}
 	Collector.AddReferencedObjects(MetallicRoughnessMaterialsMap);
 	Collector.AddReferencedObjects(SpecularGlossinessMaterialsMap);
 }
@@ -2678,6 +3106,7 @@ bool FglTFRuntimeParser::MergePrimitives(TArray<FglTFRuntimePrimitive> SourcePri
 	for (FglTFRuntimePrimitive& SourcePrimitive : SourcePrimitives)
 	{
 		OutPrimitive.Material = SourcePrimitive.Material;
+		OutPrimitive.bHasNormalTexture = BaseIndex == 0 ? SourcePrimitive.bHasNormalTexture : OutPrimitive.bHasNormalTexture || SourcePrimitive.bHasNormalTexture;
 		for (uint32 Index : SourcePrimitive.Indices)
 		{
 			OutPrimitive.Indices.Add(Index + BaseIndex);
@@ -2784,6 +3213,97 @@ bool FglTFRuntimeParser::GetMorphTargetNames(const int32 MeshIndex, TArray<FName
 	return true;
 }
 
+FglTFRuntimeMappedFile::~FglTFRuntimeMappedFile()
+{
+	// regions must be released before their handle
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+}
+
+bool FglTFRuntimeMappedFile::Map(const FString& Filename)
+{
+	MappedHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Filename));
+	if (!MappedHandle)
+	{
+		return false;
+	}
+
+	if (MappedHandle->GetFileSize() <= 0)
+	{
+		MappedHandle.Reset();
+		return false;
+	}
+
+	MappedRegion.Reset(MappedHandle->MapRegion(0, MappedHandle->GetFileSize()));
+	if (!MappedRegion)
+	{
+		MappedHandle.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+FglTFRuntimeLoadingEvent::FglTFRuntimeLoadingEvent()
+{
+	Event = FPlatformProcess::GetSynchEventFromPool(true);
+}
+
+FglTFRuntimeLoadingEvent::~FglTFRuntimeLoadingEvent()
+{
+	FPlatformProcess::ReturnSynchEventToPool(Event);
+}
+
+void FglTFRuntimeLoadingEvent::Trigger()
+{
+	Event->Trigger();
+}
+
+void FglTFRuntimeLoadingEvent::Wait()
+{
+	Event->Wait();
+}
+
+bool FglTFRuntimeStreamingFile::Open(const FString& Filename)
+{
+	FileHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*Filename));
+	return FileHandle.IsValid();
+}
+
+int64 FglTFRuntimeStreamingFile::GetFileSize() const
+{
+	return FileHandle ? FileHandle->Size() : 0;
+}
+
+bool FglTFRuntimeStreamingFile::IsBinary()
+{
+	uint8 Magic[4];
+	if (GetFileSize() <= 20 || !ReadRange(0, 4, Magic))
+	{
+		return false;
+	}
+
+	return Magic[0] == 0x67 && Magic[1] == 0x6C && Magic[2] == 0x54 && Magic[3] == 0x46;
+}
+
+bool FglTFRuntimeStreamingFile::ReadRange(const int64 Offset, const int64 Size, uint8* Destination)
+{
+	if (!FileHandle || Offset < 0 || Size < 0 || Offset + Size > FileHandle->Size())
+	{
+		return false;
+	}
+
+	// the file handle position is shared, so seek+read must be atomic
+	FScopeLock ReadScopeLock(&ReadLock);
+
+	if (!FileHandle->Seek(Offset))
+	{
+		return false;
+	}
+
+	return FileHandle->Read(Destination, Size);
+}
+
 bool FglTFRuntimeZipFile::FromData(const uint8* DataPtr, const int64 DataNum)
 {
 	Data.Append(DataPtr, DataNum);
@@ -0,0 +1,601 @@
+// Copyright 2020-2022, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "Misc/FileHelper.h"
+
+namespace glTFRuntimeJson
+{
+	/*
+	 * Minimal UTF-8 json reader building the Json DOM directly from the raw bytes.
+	 * Compared to TJsonReader<TCHAR> it does not require the whole document to be converted to an FString
+	 * (only strings are converted, with an ascii fast path).
+	 */
+	class FUTF8Reader
+	{
+	public:
+		FUTF8Reader(const uint8* InData, const int64 InNum) : Data(InData), Num(InNum), Offset(0)
+		{
+		}
+
+		TSharedPtr<FJsonValue> Parse()
+		{
+			// UTF-8 BOM
+			if (Num >= 3 && Data[0] == 0xEF && Data[1] == 0xBB && Data[2] == 0xBF)
+			{
+				Offset = 3;
+			}
+
+			SkipWhitespaces();
+
+			TSharedPtr<FJsonValue> Value = ParseValue(0);
+			if (!Value)
+			{
+				return nullptr;
+			}
+
+			// some exporters pad the GLB json chunk with zeros instead of spaces
+			while (Offset < Num && (Data[Offset] == 0 || IsWhitespace(Data[Offset])))
+			{
+				Offset++;
+			}
+
+			if (Offset != Num)
+			{
+				return nullptr;
+			}
+
+			return Value;
+		}
+
+		int64 GetOffset() const
+		{
+			return Offset;
+		}
+
+	protected:
+		const uint8* Data;
+		const int64 Num;
+		int64 Offset;
+
+		static constexpr int32 MaxDepth = 512;
+
+		FORCEINLINE bool IsWhitespace(const uint8 Char) const
+		{
+			return Char == ' ' || Char == '\t' || Char == '\n' || Char == '\r';
+		}
+
+		FORCEINLINE void SkipWhitespaces()
+		{
+			while (Offset < Num && IsWhitespace(Data[Offset]))
+			{
+				Offset++;
+			}
+		}
+
+		bool MatchLiteral(const char* Literal)
+		{
+			const int64 LiteralLen = FCStringAnsi::Strlen(Literal);
+			if (Offset + LiteralLen > Num)
+			{
+				return false;
+			}
+
+			if (FMemory::Memcmp(Data + Offset, Literal, LiteralLen) != 0)
+			{
+				return false;
+			}
+
+			Offset += LiteralLen;
+			return true;
+		}
+
+		TSharedPtr<FJsonValue> ParseValue(const int32 Depth)
+		{
+			if (Offset >= Num || Depth > MaxDepth)
+			{
+				return nullptr;
+			}
+
+			const uint8 Char = Data[Offset];
+
+			if (Char == '{')
+			{
+				TSharedPtr<FJsonObject> JsonObject = ParseObject(Depth);
+				if (!JsonObject)
+				{
+					return nullptr;
+				}
+				return MakeShared<FJsonValueObject>(JsonObject);
+			}
+
+			if (Char == '[')
+			{
+				TArray<TSharedPtr<FJsonValue>> JsonValues;
+				if (!ParseArray(Depth, JsonValues))
+				{
+					return nullptr;
+				}
+				return MakeShared<FJsonValueArray>(JsonValues);
+			}
+
+			if (Char == '"')
+			{
+				FString String;
+				if (!ParseString(String))
+				{
+					return nullptr;
+				}
+				return MakeShared<FJsonValueString>(String);
+			}
+
+			if (Char == '-' || (Char >= '0' && Char <= '9'))
+			{
+				double Number = 0;
+				if (!ParseNumber(Number))
+				{
+					return nullptr;
+				}
+				return MakeShared<FJsonValueNumber>(Number);
+			}
+
+			if (MatchLiteral("true"))
+			{
+				return MakeShared<FJsonValueBoolean>(true);
+			}
+
+			if (MatchLiteral("false"))
+			{
+				return MakeShared<FJsonValueBoolean>(false);
+			}
+
+			if (MatchLiteral("null"))
+			{
+				return MakeShared<FJsonValueNull>();
+			}
+
+			return nullptr;
+		}
+
+		TSharedPtr<FJsonObject> ParseObject(const int32 Depth)
+		{
+			// skip '{'
+			Offset++;
+
+			TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+
+			SkipWhitespaces();
+			if (Offset < Num && Data[Offset] == '}')
+			{
+				Offset++;
+				return JsonObject;
+			}
+
+			while (Offset < Num)
+			{
+				if (Data[Offset] != '"')
+				{
+					return nullptr;
+				}
+
+				FString Key;
+				if (!ParseString(Key))
+				{
+					return nullptr;
+				}
+
+				SkipWhitespaces();
+				if (Offset >= Num || Data[Offset] != ':')
+				{
+					return nullptr;
+				}
+				Offset++;
+				SkipWhitespaces();
+
+				TSharedPtr<FJsonValue> Value = ParseValue(Depth + 1);
+				if (!Value)
+				{
+					return nullptr;
+				}
+
+				JsonObject->Values.Add(MoveTemp(Key), Value);
+
+				SkipWhitespaces();
+				if (Offset >= Num)
+				{
+					return nullptr;
+				}
+
+				if (Data[Offset] == '}')
+				{
+					Offset++;
+					return JsonObject;
+				}
+
+				if (Data[Offset] != ',')
+				{
+					return nullptr;
+				}
+				Offset++;
+				SkipWhitespaces();
+			}
+
+			return nullptr;
+		}
+
+		bool ParseArray(const int32 Depth, TArray<TSharedPtr<FJsonValue>>& JsonValues)
+		{
+			// skip '['
+			Offset++;
+
+			SkipWhitespaces();
+			if (Offset < Num && Data[Offset] == ']')
+			{
+				Offset++;
+				return true;
+			}
+
+			while (Offset < Num)
+			{
+				TSharedPtr<FJsonValue> Value = ParseValue(Depth + 1);
+				if (!Value)
+				{
+					return false;
+				}
+
+				JsonValues.Add(Value);
+
+				SkipWhitespaces();
+				if (Offset >= Num)
+				{
+					return false;
+				}
+
+				if (Data[Offset] == ']')
+				{
+					Offset++;
+					return true;
+				}
+
+				if (Data[Offset] != ',')
+				{
+					return false;
+				}
+				Offset++;
+				SkipWhitespaces();
+			}
+
+			return false;
+		}
+
+		bool ParseNumber(double& Number)
+		{
+			const int64 Start = Offset;
+
+			// -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+			if (Offset < Num && Data[Offset] == '-')
+			{
+				Offset++;
+			}
+
+			if (Offset < Num && Data[Offset] == '0')
+			{
+				Offset++;
+			}
+			else if (!SkipDigits())
+			{
+				return false;
+			}
+
+			if (Offset < Num && Data[Offset] == '.')
+			{
+				Offset++;
+				if (!SkipDigits())
+				{
+					return false;
+				}
+			}
+
+			if (Offset < Num && (Data[Offset] == 'e' || Data[Offset] == 'E'))
+			{
+				Offset++;
+				if (Offset < Num && (Data[Offset] == '+' || Data[Offset] == '-'))
+				{
+					Offset++;
+				}
+				if (!SkipDigits())
+				{
+					return false;
+				}
+			}
+
+			// the token must be followed by a separator (catches things like 01 or 1-2)
+			if (Offset < Num && ((Data[Offset] >= '0' && Data[Offset] <= '9') || Data[Offset] == '-' || Data[Offset] == '+' || Data[Offset] == '.'))
+			{
+				return false;
+			}
+
+			const int64 Len = Offset - Start;
+			ANSICHAR InlineToken[64];
+			TArray<ANSICHAR> LongToken;
+			ANSICHAR* Token = InlineToken;
+			if (Len > 63)
+			{
+				LongToken.AddUninitialized(Len + 1);
+				Token = LongToken.GetData();
+			}
+			FMemory::Memcpy(Token, Data + Start, Len);
+			Token[Len] = 0;
+
+			Number = FCStringAnsi::Atod(Token);
+			return true;
+		}
+
+		bool SkipDigits()
+		{
+			const int64 Start = Offset;
+			while (Offset < Num && Data[Offset] >= '0' && Data[Offset] <= '9')
+			{
+				Offset++;
+			}
+			return Offset > Start;
+		}
+
+		bool ParseHex4(uint32& CodeUnit)
+		{
+			if (Offset + 4 > Num)
+			{
+				return false;
+			}
+
+			CodeUnit = 0;
+			for (int32 HexIndex = 0; HexIndex < 4; HexIndex++)
+			{
+				const uint8 Char = Data[Offset++];
+				CodeUnit <<= 4;
+				if (Char >= '0' && Char <= '9')
+				{
+					CodeUnit |= Char - '0';
+				}
+				else if (Char >= 'a' && Char <= 'f')
+				{
+					CodeUnit |= Char - 'a' + 10;
+				}
+				else if (Char >= 'A' && Char <= 'F')
+				{
+					CodeUnit |= Char - 'A' + 10;
+				}
+				else
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		void AppendUTF8(TArray<uint8>& UTF8, const uint32 CodePoint)
+		{
+			if (CodePoint < 0x80)
+			{
+				UTF8.Add(CodePoint);
+			}
+			else if (CodePoint < 0x800)
+			{
+				UTF8.Add(0xC0 | (CodePoint >> 6));
+				UTF8.Add(0x80 | (CodePoint & 0x3F));
+			}
+			else if (CodePoint < 0x10000)
+			{
+				UTF8.Add(0xE0 | (CodePoint >> 12));
+				UTF8.Add(0x80 | ((CodePoint >> 6) & 0x3F));
+				UTF8.Add(0x80 | (CodePoint & 0x3F));
+			}
+			else
+			{
+				UTF8.Add(0xF0 | (CodePoint >> 18));
+				UTF8.Add(0x80 | ((CodePoint >> 12) & 0x3F));
+				UTF8.Add(0x80 | ((CodePoint >> 6) & 0x3F));
+				UTF8.Add(0x80 | (CodePoint & 0x3F));
+			}
+		}
+
+		bool ParseString(FString& String)
+		{
+			// skip '"'
+			Offset++;
+
+			const int64 Start = Offset;
+			bool bSimple = true;
+
+			while (Offset < Num)
+			{
+				const uint8 Char = Data[Offset];
+				if (Char == '"')
+				{
+					break;
+				}
+
+				if (Char == '\\')
+				{
+					bSimple = false;
+					Offset += 2;
+					continue;
+				}
+
+				if (Char < 0x20)
+				{
+					return false;
+				}
+
+				if (Char >= 0x80)
+				{
+					bSimple = false;
+				}
+
+				Offset++;
+			}
+
+			if (Offset >= Num)
+			{
+				return false;
+			}
+
+			const int64 End = Offset;
+			// skip '"'
+			Offset++;
+
+			if (End - Start > MAX_int32)
+			{
+				return false;
+			}
+
+			// fast path, pure ascii without escapes (the vast majority of gltf keys and values)
+			if (bSimple)
+			{
+				String = FString((int32)(End - Start), (const ANSICHAR*)(Data + Start));
+				return true;
+			}
+
+			TArray<uint8> UTF8;
+			UTF8.Reserve(End - Start);
+
+			const int64 ResumeOffset = Offset;
+			Offset = Start;
+			while (Offset < End)
+			{
+				const uint8 Char = Data[Offset++];
+				if (Char != '\\')
+				{
+					UTF8.Add(Char);
+					continue;
+				}
+
+				if (Offset >= End)
+				{
+					return false;
+				}
+
+				const uint8 Escape = Data[Offset++];
+				switch (Escape)
+				{
+				case '"':
+				case '\\':
+				case '/':
+					UTF8.Add(Escape);
+					break;
+				case 'b':
+					UTF8.Add('\b');
+					break;
+				case 'f':
+					UTF8.Add('\f');
+					break;
+				case 'n':
+					UTF8.Add('\n');
+					break;
+				case 'r':
+					UTF8.Add('\r');
+					break;
+				case 't':
+					UTF8.Add('\t');
+					break;
+				case 'u':
+				{
+					uint32 CodePoint = 0;
+					if (!ParseHex4(CodePoint))
+					{
+						return false;
+					}
+					// surrogate pair ?
+					if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF)
+					{
+						uint32 LowSurrogate = 0;
+						if (Offset + 6 <= End && Data[Offset] == '\\' && Data[Offset + 1] == 'u')
+						{
+							Offset += 2;
+							if (!ParseHex4(LowSurrogate))
+							{
+								return false;
+							}
+						}
+
+						if (LowSurrogate >= 0xDC00 && LowSurrogate <= 0xDFFF)
+						{
+							CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+						}
+						else
+						{
+							CodePoint = 0xFFFD;
+						}
+					}
+					else if (CodePoint >= 0xDC00 && CodePoint <= 0xDFFF)
+					{
+						CodePoint = 0xFFFD;
+					}
+					AppendUTF8(UTF8, CodePoint);
+					break;
+				}
+				default:
+					return false;
+				}
+			}
+
+			Offset = ResumeOffset;
+
+#if ENGINE_MAJOR_VERSION > 4
+			FUTF8ToTCHAR Converter((const UTF8CHAR*)UTF8.GetData(), UTF8.Num());
+#else
+			FUTF8ToTCHAR Converter((const ANSICHAR*)UTF8.GetData(), UTF8.Num());
+#endif
+			String = FString(Converter.Length(), Converter.Get());
+			return true;
+		}
+	};
+}
+
+TSharedPtr<FJsonValue> FglTFRuntimeParser::ParseUTF8Json(const uint8* DataPtr, int64 DataNum, int64& ErrorOffset)
+{
+	glTFRuntimeJson::FUTF8Reader Reader(DataPtr, DataNum);
+
+	TSharedPtr<FJsonValue> RootValue = Reader.Parse();
+	ErrorOffset = RootValue ? -1 : Reader.GetOffset();
+	return RootValue;
+}
+
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromUTF8Json(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromUTF8Json, FColor::Magenta);
+
+	int64 ErrorOffset = -1;
+	TSharedPtr<FJsonValue> RootValue = ParseUTF8Json(DataPtr, DataNum, ErrorOffset);
+	if (!RootValue)
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to parse json at offset %lld"), ErrorOffset);
+		return nullptr;
+	}
+
+	TSharedPtr<FJsonObject> JsonObject = RootValue->AsObject();
+	if (!JsonObject)
+		return nullptr;
+
+	return FromJsonObject(JsonObject.ToSharedRef(), LoaderConfig, InZipFile);
+}
+
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromJsonBytes(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile)
+{
+	// UTF-16 documents (BOM) still need the FString conversion
+	const bool bHasUTF16BOM = DataNum >= 2 && ((DataPtr[0] == 0xFF && DataPtr[1] == 0xFE) || (DataPtr[0] == 0xFE && DataPtr[1] == 0xFF));
+
+	if (LoaderConfig.bUseUTF8JsonParser && !bHasUTF16BOM)
+	{
+		return FromUTF8Json(DataPtr, DataNum, LoaderConfig, InZipFile);
+	}
+
+	if (DataNum <= 0 || DataNum > INT32_MAX)
+	{
+		return nullptr;
+	}
+
+	FString JsonData;
+	FFileHelper::BufferToString(JsonData, DataPtr, (int32)DataNum);
+	return FromString(JsonData, LoaderConfig, InZipFile);
+}
@@ -2,10 +2,12 @@
 
 #include "glTFRuntimeParser.h"
 #include "glTFRuntimeImageLoader.h"
+#include "glTFRuntimeTaskScheduler.h"
 #include "IImageWrapperModule.h"
 #include "IImageWrapper.h"
 #include "ImageUtils.h"
 #include "Misc/FileHelper.h"
+#include "Misc/ScopeExit.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Math/UnrealMathUtility.h"
 #include "Modules/ModuleManager.h"
@@ -211,7 +213,7 @@ UMaterialInterface* FglTFRuntimeParser::LoadMaterial_Internal(const int32 Index,
 
 	UMaterialInterface* Material = nullptr;
 
-	FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([this, Index, MaterialName, &Material, &RuntimeMaterial, MaterialsConfig, bUseVertexColors]()
+	FglTFRuntimeTaskScheduler::RunOnGameThread([this, Index, MaterialName, &Material, &RuntimeMaterial, MaterialsConfig, bUseVertexColors]()
 		{
 			// this is mainly for editor ...
 			if (IsGarbageCollecting())
@@ -219,8 +221,7 @@ UMaterialInterface* FglTFRuntimeParser::LoadMaterial_Internal(const int32 Index,
 				return;
 			}
 			Material = BuildMaterial(Index, MaterialName, RuntimeMaterial, MaterialsConfig, bUseVertexColors);
-		}, TStatId(), nullptr, ENamedThreads::GameThread);
-	FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+		});
 
 	return Material;
 }
@@ -292,7 +293,10 @@ UTexture2D* FglTFRuntimeParser::BuildTexture(UObject* Outer, const TArray<FglTFR
 
 	Texture->UpdateResource();
 
-	TexturesCache.Add(Mips[0].TextureIndex, Texture);
+	{
+		FScopeLock Lock(&TexturesCacheLock);
+		TexturesCache.Add(Mips[0].TextureIndex, Texture);
+	}
 
 	return Texture;
 }
@@ -370,7 +374,17 @@ UMaterialInterface* FglTFRuntimeParser::BuildMaterial(const int32 Index, const F
 		UTexture2D* Texture = TextureCache;
 		if (!Texture)
 		{
+			// another material (loaded concurrently) may have already built the same texture
 			if (Mips.Num() > 0)
+			{
+				FScopeLock Lock(&TexturesCacheLock);
+				if (UTexture2D** CachedTexture = TexturesCache.Find(Mips[0].TextureIndex))
+				{
+					Texture = *CachedTexture;
+				}
+			}
+
+			if (!Texture && Mips.Num() > 0)
 			{
 				FglTFRuntimeImagesConfig ImagesConfig = MaterialsConfig.ImagesConfig;
 				ImagesConfig.Compression = Compression;
@@ -553,31 +567,23 @@ UTexture2D* FglTFRuntimeParser::LoadTexture(const int32 TextureIndex, TArray<Fgl
 	}
 
 	// first check cache
-	if (TexturesCache.Contains(TextureIndex))
 	{
-		return TexturesCache[TextureIndex];
-	}
-
-	const TArray<TSharedPtr<FJsonValue>>* JsonTextures;
-	// no images ?
-	if (!Root->TryGetArrayField("textures", JsonTextures))
-	{
-		return nullptr;
+		FScopeLock Lock(&TexturesCacheLock);
+		if (UTexture2D** CachedTexture = TexturesCache.Find(TextureIndex))
+		{
+			return *CachedTexture;
+		}
 	}
 
-	if (TextureIndex >= JsonTextures->Num())
+	if (!TextureDescs.IsValidIndex(TextureIndex))
 	{
 		return nullptr;
 	}
 
-	TSharedPtr<FJsonObject> JsonTextureObject = (*JsonTextures)[TextureIndex]->AsObject();
-	if (!JsonTextureObject)
-	{
-		return nullptr;
-	}
+	const FglTFRuntimeTextureDesc& TextureDesc = TextureDescs[TextureIndex];
 
-	int64 ImageIndex;
-	if (!JsonTextureObject->TryGetNumberField("source", ImageIndex))
+	const int32 ImageIndex = TextureDesc.Source;
+	if (ImageIndex < 0)
 	{
 		return nullptr;
 	}
@@ -659,67 +665,42 @@ UTexture2D* FglTFRuntimeParser::LoadTexture(const int32 TextureIndex, TArray<Fgl
 
 	}
 
-	int64 SamplerIndex;
-	if (JsonTextureObject->TryGetNumberField("sampler", SamplerIndex))
+	const int32 SamplerIndex = TextureDesc.Sampler;
+	if (SamplerIndex >= 0)
 	{
-		const TArray<TSharedPtr<FJsonValue>>* JsonSamplers;
-		// no samplers ?
-		if (!Root->TryGetArrayField("samplers", JsonSamplers))
+		if (!SamplerDescs.IsValidIndex(SamplerIndex))
 		{
-			UE_LOG(LogGLTFRuntime, Warning, TEXT("No texture sampler defined!"));
+			UE_LOG(LogGLTFRuntime, Warning, TEXT("Invalid texture sampler index: %d"), SamplerIndex);
 		}
 		else
 		{
-			if (SamplerIndex >= JsonSamplers->Num())
+			const FglTFRuntimeSamplerDesc& SamplerDesc = SamplerDescs[SamplerIndex];
+			if (SamplerDesc.MinFilter == 9728)
 			{
-				UE_LOG(LogGLTFRuntime, Warning, TEXT("Invalid texture sampler index: %lld"), SamplerIndex);
+				Sampler.MinFilter = TextureFilter::TF_Nearest;
 			}
-			else
+
+			if (SamplerDesc.MagFilter == 9728)
 			{
-				TSharedPtr<FJsonObject> JsonSamplerObject = (*JsonSamplers)[SamplerIndex]->AsObject();
-				if (JsonSamplerObject)
-				{
-					int64 MinFilter;
-					if (JsonSamplerObject->TryGetNumberField("minFilter", MinFilter))
-					{
-						if (MinFilter == 9728)
-						{
-							Sampler.MinFilter = TextureFilter::TF_Nearest;
-						}
-					}
-					int64 MagFilter;
-					if (JsonSamplerObject->TryGetNumberField("magFilter", MagFilter))
-					{
-						if (MagFilter == 9728)
-						{
-							Sampler.MagFilter = TextureFilter::TF_Nearest;
-						}
-					}
-					int64 WrapS;
-					if (JsonSamplerObject->TryGetNumberField("wrapS", WrapS))
-					{
-						if (WrapS == 33071)
-						{
-							Sampler.TileX = TextureAddress::TA_Clamp;
-						}
-						else if (WrapS == 33648)
-						{
-							Sampler.TileX = TextureAddress::TA_Mirror;
-						}
-					}
-					int64 WrapT;
-					if (JsonSamplerObject->TryGetNumberField("wrapT", WrapT))
-					{
-						if (WrapT == 33071)
-						{
-							Sampler.TileY = TextureAddress::TA_Clamp;
-						}
-						else if (WrapT == 33648)
-						{
-							Sampler.TileY = TextureAddress::TA_Mirror;
-						}
-					}
-				}
+				Sampler.MagFilter = TextureFilter::TF_Nearest;
+			}
+
+			if (SamplerDesc.WrapS == 33071)
+			{
+				Sampler.TileX = TextureAddress::TA_Clamp;
+			}
+			else if (SamplerDesc.WrapS == 33648)
+			{
+				Sampler.TileX = TextureAddress::TA_Mirror;
+			}
+
+			if (SamplerDesc.WrapT == 33071)
+			{
+				Sampler.TileY = TextureAddress::TA_Clamp;
+			}
+			else if (SamplerDesc.WrapT == 33648)
+			{
+				Sampler.TileY = TextureAddress::TA_Mirror;
 			}
 		}
 	}
@@ -739,16 +720,59 @@ UMaterialInterface* FglTFRuntimeParser::LoadMaterial(const int32 Index, const Fg
 		return MaterialsConfig.MaterialsOverrideMap[Index];
 	}
 
-	// first check cache
-	if (CanReadFromCache(MaterialsConfig.CacheMode) && MaterialsCache.Contains(Index))
+	// first check cache (waiting for other workers currently loading the same material)
+	bool bLoading = false;
+	if (CanReadFromCache(MaterialsConfig.CacheMode))
 	{
-		if (MaterialsNameCache.Contains(MaterialsCache[Index]))
+		for (;;)
 		{
-			MaterialName = MaterialsNameCache[MaterialsCache[Index]];
+			TSharedPtr<FglTFRuntimeLoadingEvent, ESPMode::ThreadSafe> LoadingEvent;
+			{
+				FScopeLock Lock(&MaterialsCacheLock);
+				if (UMaterialInterface** CachedMaterial = MaterialsCache.Find(Index))
+				{
+					if (const FString* CachedMaterialName = MaterialsNameCache.Find(*CachedMaterial))
+					{
+						MaterialName = *CachedMaterialName;
+					}
+					return *CachedMaterial;
+				}
+
+				// the game thread never waits, the loading workers may need it for building their materials
+				if (const TSharedPtr<FglTFRuntimeLoadingEvent, ESPMode::ThreadSafe>* MaterialLoading = MaterialsLoading.Find(Index))
+				{
+					LoadingEvent = *MaterialLoading;
+				}
+				else
+				{
+					MaterialsLoading.Add(Index, MakeShared<FglTFRuntimeLoadingEvent, ESPMode::ThreadSafe>());
+					bLoading = true;
+					break;
+				}
+
+				if (IsInGameThread())
+				{
+					break;
+				}
+			}
+			// woken up when the material is cached (or its load failed), then check again
+			LoadingEvent->Wait();
 		}
-		return MaterialsCache[Index];
 	}
 
+	ON_SCOPE_EXIT
+	{
+		if (bLoading)
+		{
+			TSharedPtr<FglTFRuntimeLoadingEvent, ESPMode::ThreadSafe> LoadingEvent;
+			{
+				FScopeLock Lock(&MaterialsCacheLock);
+				MaterialsLoading.RemoveAndCopyValue(Index, LoadingEvent);
+			}
+			LoadingEvent->Trigger();
+		}
+	};
+
 	const TArray<TSharedPtr<FJsonValue>>* JsonMaterials;
 
 	// no materials ?
@@ -787,6 +811,7 @@ UMaterialInterface* FglTFRuntimeParser::LoadMaterial(const int32 Index, const Fg
 
 	if (CanWriteToCache(MaterialsConfig.CacheMode))
 	{
+		FScopeLock Lock(&MaterialsCacheLock);
 		MaterialsNameCache.Add(Material, MaterialName);
 		MaterialsCache.Add(Index, Material);
 	}
@@ -0,0 +1,654 @@
+// Copyright 2020-2022, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+
+/*
+ * EXT_meshopt_compression bitstream decoders (attributes v0, triangles v0/v1 and indices v0/v1)
+ * and the OCTAHEDRAL, QUATERNION and EXPONENTIAL filters.
+ * Every read is bounds checked against the stream, malformed data results in a failure (never in a crash).
+ */
+namespace glTFRuntimeMeshopt
+{
+	constexpr int32 ByteGroupSize = 16;
+	constexpr int32 ByteGroupDecodeLimit = 24;
+	constexpr int32 VertexBlockSizeBytes = 8192;
+	constexpr int32 VertexBlockMaxSize = 256;
+	constexpr int32 TailMaxSize = 32;
+
+	FORCEINLINE uint8 Unzigzag8(const uint8 Value)
+	{
+		return (0 - (Value & 1)) ^ (Value >> 1);
+	}
+
+	FORCEINLINE uint32 DecodeVByte(const uint8*& Data)
+	{
+		const uint8 Lead = *Data++;
+		if (Lead < 128)
+		{
+			return Lead;
+		}
+
+		// varints are at most 5 bytes long
+		uint32 Result = Lead & 127;
+		int32 Shift = 7;
+		for (int32 Index = 0; Index < 4; Index++)
+		{
+			const uint8 Group = *Data++;
+			Result |= uint32(Group & 127) << Shift;
+			Shift += 7;
+			if (Group < 128)
+			{
+				break;
+			}
+		}
+		return Result;
+	}
+
+	FORCEINLINE uint32 DecodeIndex(const uint8*& Data, const uint32 Last)
+	{
+		const uint32 Value = DecodeVByte(Data);
+		const uint32 Delta = (Value >> 1) ^ (0 - (Value & 1));
+		return Last + Delta;
+	}
+
+	const uint8* DecodeBytesGroup(const uint8* Data, uint8* Buffer, const int32 BitsLog2)
+	{
+		if (BitsLog2 == 0)
+		{
+			FMemory::Memzero(Buffer, ByteGroupSize);
+			return Data;
+		}
+
+		if (BitsLog2 == 3)
+		{
+			FMemory::Memcpy(Buffer, Data, ByteGroupSize);
+			return Data + ByteGroupSize;
+		}
+
+		// 2 or 4 bits per value (msb first), the all ones value escapes to a full byte stored after the packed ones
+		const int32 Bits = BitsLog2 == 1 ? 2 : 4;
+		const uint8 Escape = (1 << Bits) - 1;
+		const uint8* Packed = Data;
+		const uint8* Extra = Data + (ByteGroupSize * Bits) / 8;
+		for (int32 Index = 0; Index < ByteGroupSize; Index++)
+		{
+			const int32 BitOffset = Index * Bits;
+			const uint8 Value = (Packed[BitOffset / 8] >> (8 - Bits - (BitOffset % 8))) & Escape;
+			if (Value == Escape)
+			{
+				Buffer[Index] = *Extra++;
+			}
+			else
+			{
+				Buffer[Index] = Value;
+			}
+		}
+		return Extra;
+	}
+
+	const uint8* DecodeBytes(const uint8* Data, const uint8* DataEnd, uint8* Buffer, const int32 BufferSize)
+	{
+		// 2 bits header for each group
+		const uint8* Header = Data;
+		const int32 HeaderSize = (BufferSize / ByteGroupSize + 3) / 4;
+		if (DataEnd - Data < HeaderSize)
+		{
+			return nullptr;
+		}
+
+		Data += HeaderSize;
+
+		for (int32 Index = 0; Index < BufferSize; Index += ByteGroupSize)
+		{
+			if (DataEnd - Data < ByteGroupDecodeLimit)
+			{
+				return nullptr;
+			}
+
+			const int32 HeaderOffset = Index / ByteGroupSize;
+			const int32 BitsLog2 = (Header[HeaderOffset / 4] >> ((HeaderOffset % 4) * 2)) & 3;
+			Data = DecodeBytesGroup(Data, Buffer + Index, BitsLog2);
+		}
+
+		return Data;
+	}
+
+	const uint8* DecodeVertexBlock(const uint8* Data, const uint8* DataEnd, uint8* VertexData, const int32 VertexCount, const int32 VertexSize, uint8* LastVertex)
+	{
+		uint8 Buffer[VertexBlockMaxSize];
+		const int32 VertexCountAligned = (VertexCount + ByteGroupSize - 1) & ~(ByteGroupSize - 1);
+
+		// every byte of the vertex is a separate delta encoded stream
+		for (int32 ByteIndex = 0; ByteIndex < VertexSize; ByteIndex++)
+		{
+			Data = DecodeBytes(Data, DataEnd, Buffer, VertexCountAligned);
+			if (!Data)
+			{
+				return nullptr;
+			}
+
+			uint8 Previous = LastVertex[ByteIndex];
+			uint8* Destination = VertexData + ByteIndex;
+			for (int32 VertexIndex = 0; VertexIndex < VertexCount; VertexIndex++)
+			{
+				const uint8 Value = Unzigzag8(Buffer[VertexIndex]) + Previous;
+				*Destination = Value;
+				Previous = Value;
+				Destination += VertexSize;
+			}
+		}
+
+		FMemory::Memcpy(LastVertex, VertexData + (VertexCount - 1) * VertexSize, VertexSize);
+		return Data;
+	}
+
+	bool DecodeVertexBuffer(uint8* Destination, const int64 VertexCount, const int32 VertexSize, const uint8* Data, const int64 DataSize)
+	{
+		if (VertexSize <= 0 || VertexSize > 256 || VertexSize % 4 != 0)
+		{
+			return false;
+		}
+
+		const uint8* DataEnd = Data + DataSize;
+		if (DataSize < 1 + VertexSize)
+		{
+			return false;
+		}
+
+		const uint8 DataHeader = *Data++;
+		if ((DataHeader & 0xF0) != 0xA0 || (DataHeader & 0x0F) > 0)
+		{
+			return false;
+		}
+
+		// the stream ends with the first vertex, used as the baseline for the deltas
+		uint8 LastVertex[256];
+		FMemory::Memcpy(LastVertex, DataEnd - VertexSize, VertexSize);
+
+		const int32 VertexBlockSize = FMath::Min((VertexBlockSizeBytes / VertexSize) & ~(ByteGroupSize - 1), VertexBlockMaxSize);
+
+		for (int64 VertexOffset = 0; VertexOffset < VertexCount; VertexOffset += VertexBlockSize)
+		{
+			const int32 BlockSize = (int32)FMath::Min<int64>(VertexBlockSize, VertexCount - VertexOffset);
+			Data = DecodeVertexBlock(Data, DataEnd, Destination + VertexOffset * VertexSize, BlockSize, VertexSize, LastVertex);
+			if (!Data)
+			{
+				return false;
+			}
+		}
+
+		const int64 TailSize = FMath::Max(VertexSize, TailMaxSize);
+		return DataEnd - Data == TailSize;
+	}
+
+	FORCEINLINE void WriteIndex(uint8* Destination, const int64 Offset, const int32 IndexSize, const uint32 Value)
+	{
+		if (IndexSize == 2)
+		{
+			reinterpret_cast<uint16*>(Destination)[Offset] = (uint16)Value;
+		}
+		else
+		{
+			reinterpret_cast<uint32*>(Destination)[Offset] = Value;
+		}
+	}
+
+	FORCEINLINE void PushEdge(uint32 EdgeFifo[16][2], const uint32 A, const uint32 B, uint32& Offset)
+	{
+		EdgeFifo[Offset][0] = A;
+		EdgeFifo[Offset][1] = B;
+		Offset = (Offset + 1) & 15;
+	}
+
+	FORCEINLINE void PushVertex(uint32 VertexFifo[16], const uint32 Vertex, uint32& Offset, const bool bCondition = true)
+	{
+		VertexFifo[Offset] = Vertex;
+		Offset = (Offset + (bCondition ? 1 : 0)) & 15;
+	}
+
+	bool DecodeIndexBuffer(uint8* Destination, const int64 IndexCount, const int32 IndexSize, const uint8* Buffer, const int64 BufferSize)
+	{
+		if (IndexCount % 3 != 0 || (IndexSize != 2 && IndexSize != 4))
+		{
+			return false;
+		}
+
+		// header, one code per triangle and the 16 bytes codeaux table
+		if (BufferSize < 1 + IndexCount / 3 + 16)
+		{
+			return false;
+		}
+
+		if ((Buffer[0] & 0xF0) != 0xE0)
+		{
+			return false;
+		}
+
+		const int32 Version = Buffer[0] & 0x0F;
+		if (Version > 1)
+		{
+			return false;
+		}
+
+		uint32 EdgeFifo[16][2];
+		uint32 VertexFifo[16];
+		FMemory::Memset(EdgeFifo, 0xFF, sizeof(EdgeFifo));
+		FMemory::Memset(VertexFifo, 0xFF, sizeof(VertexFifo));
+		uint32 EdgeFifoOffset = 0;
+		uint32 VertexFifoOffset = 0;
+
+		uint32 Next = 0;
+		uint32 Last = 0;
+
+		const int32 FecMax = Version >= 1 ? 13 : 15;
+
+		const uint8* Code = Buffer + 1;
+		const uint8* Data = Code + IndexCount / 3;
+		const uint8* DataSafeEnd = Buffer + BufferSize - 16;
+		const uint8* CodeAuxTable = DataSafeEnd;
+
+		for (int64 Index = 0; Index < IndexCount; Index += 3)
+		{
+			// a triangle reads at most 16 bytes, that are always available before the end of the codeaux table
+			if (Data > DataSafeEnd)
+			{
+				return false;
+			}
+
+			const uint8 CodeTri = *Code++;
+
+			if (CodeTri < 0xF0)
+			{
+				// edge from the fifo, third vertex from the vertex fifo, the next one or explicitly encoded
+				const int32 Fe = CodeTri >> 4;
+				const uint32 A = EdgeFifo[(EdgeFifoOffset - 1 - Fe) & 15][0];
+				const uint32 B = EdgeFifo[(EdgeFifoOffset - 1 - Fe) & 15][1];
+
+				const int32 Fec = CodeTri & 15;
+				if (Fec < FecMax)
+				{
+					const uint32 C = Fec == 0 ? Next : VertexFifo[(VertexFifoOffset - 1 - Fec) & 15];
+					const bool bFec0 = Fec == 0;
+					Next += bFec0 ? 1 : 0;
+
+					WriteIndex(Destination, Index, IndexSize, A);
+					WriteIndex(Destination, Index + 1, IndexSize, B);
+					WriteIndex(Destination, Index + 2, IndexSize, C);
+
+					PushVertex(VertexFifo, C, VertexFifoOffset, bFec0);
+					PushEdge(EdgeFifo, C, B, EdgeFifoOffset);
+					PushEdge(EdgeFifo, A, C, EdgeFifoOffset);
+				}
+				else
+				{
+					// 13 and 14 (version 1) are -1 and +1 deltas from the last explicit index
+					const uint32 C = Fec != 15 ? Last + (Fec - (Fec ^ 3)) : DecodeIndex(Data, Last);
+					Last = C;
+
+					WriteIndex(Destination, Index, IndexSize, A);
+					WriteIndex(Destination, Index + 1, IndexSize, B);
+					WriteIndex(Destination, Index + 2, IndexSize, C);
+
+					PushVertex(VertexFifo, C, VertexFifoOffset);
+					PushEdge(EdgeFifo, C, B, EdgeFifoOffset);
+					PushEdge(EdgeFifo, A, C, EdgeFifoOffset);
+				}
+			}
+			else if (CodeTri < 0xFE)
+			{
+				// no edge reuse, codeaux from the table
+				const uint8 CodeAux = CodeAuxTable[CodeTri & 15];
+				const int32 Feb = CodeAux >> 4;
+				const int32 Fec = CodeAux & 15;
+
+				const uint32 A = Next++;
+
+				const uint32 B = Feb == 0 ? Next : VertexFifo[(VertexFifoOffset - Feb) & 15];
+				const bool bFeb0 = Feb == 0;
+				Next += bFeb0 ? 1 : 0;
+
+				const uint32 C = Fec == 0 ? Next : VertexFifo[(VertexFifoOffset - Fec) & 15];
+				const bool bFec0 = Fec == 0;
+				Next += bFec0 ? 1 : 0;
+
+				WriteIndex(Destination, Index, IndexSize, A);
+				WriteIndex(Destination, Index + 1, IndexSize, B);
+				WriteIndex(Destination, Index + 2, IndexSize, C);
+
+				PushVertex(VertexFifo, A, VertexFifoOffset);
+				PushVertex(VertexFifo, B, VertexFifoOffset, bFeb0);
+				PushVertex(VertexFifo, C, VertexFifoOffset, bFec0);
+				PushEdge(EdgeFifo, B, A, EdgeFifoOffset);
+				PushEdge(EdgeFifo, C, B, EdgeFifoOffset);
+				PushEdge(EdgeFifo, A, C, EdgeFifoOffset);
+			}
+			else
+			{
+				// no edge reuse, full codeaux byte (0 resets the next vertex counter)
+				const uint8 CodeAux = *Data++;
+				const int32 Fea = CodeTri == 0xFE ? 0 : 15;
+				const int32 Feb = CodeAux >> 4;
+				const int32 Fec = CodeAux & 15;
+
+				if (CodeAux == 0)
+				{
+					Next = 0;
+				}
+
+				uint32 A = Fea == 0 ? Next++ : 0;
+				uint32 B = Feb == 0 ? Next++ : VertexFifo[(VertexFifoOffset - Feb) & 15];
+				uint32 C = Fec == 0 ? Next++ : VertexFifo[(VertexFifoOffset - Fec) & 15];
+
+				if (Fea == 15)
+				{
+					Last = A = DecodeIndex(Data, Last);
+				}
+				if (Feb == 15)
+				{
+					Last = B = DecodeIndex(Data, Last);
+				}
+				if (Fec == 15)
+				{
+					Last = C = DecodeIndex(Data, Last);
+				}
+
+				WriteIndex(Destination, Index, IndexSize, A);
+				WriteIndex(Destination, Index + 1, IndexSize, B);
+				WriteIndex(Destination, Index + 2, IndexSize, C);
+
+				PushVertex(VertexFifo, A, VertexFifoOffset);
+				PushVertex(VertexFifo, B, VertexFifoOffset, Feb == 0 || Feb == 15);
+				PushVertex(VertexFifo, C, VertexFifoOffset, Fec == 0 || Fec == 15);
+				PushEdge(EdgeFifo, B, A, EdgeFifoOffset);
+				PushEdge(EdgeFifo, C, B, EdgeFifoOffset);
+				PushEdge(EdgeFifo, A, C, EdgeFifoOffset);
+			}
+		}
+
+		// all of the data must have been consumed, up to the codeaux table
+		return Data == DataSafeEnd;
+	}
+
+	bool DecodeIndexSequence(uint8* Destination, const int64 IndexCount, const int32 IndexSize, const uint8* Buffer, const int64 BufferSize)
+	{
+		if (IndexSize != 2 && IndexSize != 4)
+		{
+			return false;
+		}
+
+		// header, at least one byte per index and a 4 bytes tail
+		if (BufferSize < 1 + IndexCount + 4)
+		{
+			return false;
+		}
+
+		if ((Buffer[0] & 0xF0) != 0xD0 || (Buffer[0] & 0x0F) > 1)
+		{
+			return false;
+		}
+
+		const uint8* Data = Buffer + 1;
+		const uint8* DataSafeEnd = Buffer + BufferSize - 4;
+
+		// two baselines, selected by the lowest bit
+		uint32 Last[2] = { 0, 0 };
+
+		for (int64 Index = 0; Index < IndexCount; Index++)
+		{
+			if (Data >= DataSafeEnd)
+			{
+				return false;
+			}
+
+			uint32 Value = DecodeVByte(Data);
+			const uint32 Current = Value & 1;
+			Value >>= 1;
+
+			const uint32 Delta = (Value >> 1) ^ (0 - (Value & 1));
+			Last[Current] += Delta;
+
+			WriteIndex(Destination, Index, IndexSize, Last[Current]);
+		}
+
+		return Data == DataSafeEnd;
+	}
+
+	FORCEINLINE int32 RoundSigned(const float Value)
+	{
+		return int32(Value + (Value >= 0.f ? 0.5f : -0.5f));
+	}
+
+	template<typename T>
+	void DecodeFilterOctahedral(T* Data, const int64 Count)
+	{
+		const float MaxValue = float((1 << (sizeof(T) * 8 - 1)) - 1);
+
+		for (int64 Index = 0; Index < Count; Index++)
+		{
+			// z is reconstructed assuming the third component encodes 1.0 with the same precision
+			float X = float(Data[Index * 4 + 0]);
+			float Y = float(Data[Index * 4 + 1]);
+			const float Z = float(Data[Index * 4 + 2]) - FMath::Abs(X) - FMath::Abs(Y);
+
+			// octahedral fixup for the lower hemisphere
+			const float T0 = Z >= 0.f ? 0.f : Z;
+			X += X >= 0.f ? T0 : -T0;
+			Y += Y >= 0.f ? T0 : -T0;
+
+			const float Length = FMath::Sqrt(X * X + Y * Y + Z * Z);
+			const float Scale = MaxValue / Length;
+
+			Data[Index * 4 + 0] = T(RoundSigned(X * Scale));
+			Data[Index * 4 + 1] = T(RoundSigned(Y * Scale));
+			Data[Index * 4 + 2] = T(RoundSigned(Z * Scale));
+		}
+	}
+
+	void DecodeFilterQuaternion(int16* Data, const int64 Count)
+	{
+		const float Scale = 1.f / FMath::Sqrt(2.f);
+
+		for (int64 Index = 0; Index < Count; Index++)
+		{
+			// the scale is stored in the high bits of the fourth component, the lowest 2 bits are the index of the largest component
+			const int32 ScaleBits = Data[Index * 4 + 3] | 3;
+			const float ComponentScale = Scale / float(ScaleBits);
+
+			const float X = float(Data[Index * 4 + 0]) * ComponentScale;
+			const float Y = float(Data[Index * 4 + 1]) * ComponentScale;
+			const float Z = float(Data[Index * 4 + 2]) * ComponentScale;
+
+			const float WW = 1.f - X * X - Y * Y - Z * Z;
+			const float W = FMath::Sqrt(WW >= 0.f ? WW : 0.f);
+
+			const int32 MaxComponent = Data[Index * 4 + 3] & 3;
+
+			Data[Index * 4 + ((MaxComponent + 1) & 3)] = int16(RoundSigned(X * 32767.f));
+			Data[Index * 4 + ((MaxComponent + 2) & 3)] = int16(RoundSigned(Y * 32767.f));
+			Data[Index * 4 + ((MaxComponent + 3) & 3)] = int16(RoundSigned(Z * 32767.f));
+			Data[Index * 4 + ((MaxComponent + 0) & 3)] = int16(int32(W * 32767.f + 0.5f));
+		}
+	}
+
+	void DecodeFilterExponential(uint32* Data, const int64 Count)
+	{
+		for (int64 Index = 0; Index < Count; Index++)
+		{
+			// 24 bits signed mantissa and 8 bits signed exponent
+			const uint32 Value = Data[Index];
+			const int32 Mantissa = int32(Value << 8) >> 8;
+			const int32 Exponent = int32(Value) >> 24;
+
+			// ldexp(Mantissa, Exponent) building the power of two directly
+			const uint32 PowerBits = uint32(Exponent + 127) << 23;
+			float Power;
+			FMemory::Memcpy(&Power, &PowerBits, sizeof(float));
+			const float Result = Power * float(Mantissa);
+			FMemory::Memcpy(&Data[Index], &Result, sizeof(float));
+		}
+	}
+}
+
+bool FglTFRuntimeParser::DecodeMeshoptBufferView(int32 Index, FglTFRuntimeBlob& Blob)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_DecodeMeshoptBufferView, FColor::Magenta);
+
+	{
+		FScopeLock Lock(&DecodedBufferViewsCacheLock);
+		if (TSharedPtr<TArray64<uint8>, ESPMode::ThreadSafe>* CachedBufferView = DecodedBufferViewsCache.Find(Index))
+		{
+			DecodedBufferViewsLRU.RemoveSingle(Index);
+			DecodedBufferViewsLRU.Add(Index);
+			Blob.Owner = *CachedBufferView;
+			Blob.Data = Blob.Owner->GetData();
+			Blob.Num = Blob.Owner->Num();
+			return true;
+		}
+	}
+
+	const FglTFRuntimeBufferViewDesc& BufferViewDesc = BufferViewDescs[Index];
+
+	const int64 Count = BufferViewDesc.MeshoptCount;
+	const int64 Stride = BufferViewDesc.MeshoptByteStride;
+	const int64 ByteOffset = BufferViewDesc.MeshoptByteOffset;
+	const int64 ByteLength = BufferViewDesc.MeshoptByteLength;
+
+	if (Count < 0 || Stride <= 0 || Count * Stride > BufferViewDesc.ByteLength || ByteOffset < 0 || ByteLength < 0)
+	{
+		AddError("DecodeMeshoptBufferView()", FString::Printf(TEXT("Invalid EXT_meshopt_compression bufferView %d"), Index));
+		return false;
+	}
+
+	// compressed data from streamed GLB is read on demand (and discarded after decoding)
+	TArray64<uint8> StreamedBytes;
+	FglTFRuntimeBlob CompressedBlob;
+	if (BufferViewDesc.MeshoptBuffer == 0 && StreamingFile)
+	{
+		if (ByteOffset + ByteLength > StreamingBinaryChunkLength)
+		{
+			return false;
+		}
+
+		StreamedBytes.AddUninitialized(ByteLength);
+		{
+			FScopeLock StreamingScopeLock(&StreamingLock);
+			if (!StreamingFile->ReadRange(StreamingBinaryChunkOffset + ByteOffset, ByteLength, StreamedBytes.GetData()))
+			{
+				AddError("DecodeMeshoptBufferView()", FString::Printf(TEXT("Unable to read bufferView %d from file"), Index));
+				return false;
+			}
+		}
+		CompressedBlob.Data = StreamedBytes.GetData();
+		CompressedBlob.Num = StreamedBytes.Num();
+	}
+	else
+	{
+		FglTFRuntimeBlob WholeData;
+		if (!GetBuffer(BufferViewDesc.MeshoptBuffer, WholeData))
+		{
+			return false;
+		}
+
+		if (ByteOffset + ByteLength > WholeData.Num)
+		{
+			return false;
+		}
+
+		CompressedBlob.Data = WholeData.Data + ByteOffset;
+		CompressedBlob.Num = ByteLength;
+	}
+
+	// bytes not covered by the decoded elements are zeroed
+	TSharedPtr<TArray64<uint8>, ESPMode::ThreadSafe> DecodedBytes = MakeShared<TArray64<uint8>, ESPMode::ThreadSafe>();
+	TArray64<uint8>& Bytes = *DecodedBytes;
+	Bytes.AddZeroed(BufferViewDesc.ByteLength);
+
+	bool bSuccess = false;
+	switch (BufferViewDesc.MeshoptMode)
+	{
+	case EglTFRuntimeMeshoptMode::Attributes:
+		bSuccess = glTFRuntimeMeshopt::DecodeVertexBuffer(Bytes.GetData(), Count, (int32)Stride, CompressedBlob.Data, CompressedBlob.Num);
+		break;
+	case EglTFRuntimeMeshoptMode::Triangles:
+		bSuccess = glTFRuntimeMeshopt::DecodeIndexBuffer(Bytes.GetData(), Count, (int32)Stride, CompressedBlob.Data, CompressedBlob.Num);
+		break;
+	case EglTFRuntimeMeshoptMode::Indices:
+		bSuccess = glTFRuntimeMeshopt::DecodeIndexSequence(Bytes.GetData(), Count, (int32)Stride, CompressedBlob.Data, CompressedBlob.Num);
+		break;
+	default:
+		break;
+	}
+
+	if (!bSuccess)
+	{
+		AddError("DecodeMeshoptBufferView()", FString::Printf(TEXT("Unable to decode EXT_meshopt_compression bufferView %d"), Index));
+		return false;
+	}
+
+	if (BufferViewDesc.MeshoptMode == EglTFRuntimeMeshoptMode::Attributes)
+	{
+		switch (BufferViewDesc.MeshoptFilter)
+		{
+		case EglTFRuntimeMeshoptFilter::Octahedral:
+			if (Stride == 4)
+			{
+				glTFRuntimeMeshopt::DecodeFilterOctahedral(reinterpret_cast<int8*>(Bytes.GetData()), Count);
+			}
+			else if (Stride == 8)
+			{
+				glTFRuntimeMeshopt::DecodeFilterOctahedral(reinterpret_cast<int16*>(Bytes.GetData()), Count);
+			}
+			else
+			{
+				bSuccess = false;
+			}
+			break;
+		case EglTFRuntimeMeshoptFilter::Quaternion:
+			if (Stride == 8)
+			{
+				glTFRuntimeMeshopt::DecodeFilterQuaternion(reinterpret_cast<int16*>(Bytes.GetData()), Count);
+			}
+			else
+			{
+				bSuccess = false;
+			}
+			break;
+		case EglTFRuntimeMeshoptFilter::Exponential:
+			glTFRuntimeMeshopt::DecodeFilterExponential(reinterpret_cast<uint32*>(Bytes.GetData()), Count * Stride / 4);
+			break;
+		default:
+			break;
+		}
+	}
+
+	if (!bSuccess)
+	{
+		AddError("DecodeMeshoptBufferView()", FString::Printf(TEXT("Invalid EXT_meshopt_compression filter for bufferView %d"), Index));
+		return false;
+	}
+
+	// another thread could have decoded the same bufferView in the meantime
+	FScopeLock Lock(&DecodedBufferViewsCacheLock);
+	if (TSharedPtr<TArray64<uint8>, ESPMode::ThreadSafe>* CachedBufferView = DecodedBufferViewsCache.Find(Index))
+	{
+		DecodedBytes = *CachedBufferView;
+	}
+	else if (DecodedBytes->Num() <= DecodedBufferViewsCacheMaxSize)
+	{
+		while (DecodedBufferViewsCacheSize + DecodedBytes->Num() > DecodedBufferViewsCacheMaxSize && DecodedBufferViewsLRU.Num() > 0)
+		{
+			TSharedPtr<TArray64<uint8>, ESPMode::ThreadSafe> EvictedBufferView;
+			DecodedBufferViewsCache.RemoveAndCopyValue(DecodedBufferViewsLRU[0], EvictedBufferView);
+			DecodedBufferViewsCacheSize -= EvictedBufferView->Num();
+			DecodedBufferViewsLRU.RemoveAt(0);
+		}
+		DecodedBufferViewsCache.Add(Index, DecodedBytes);
+		DecodedBufferViewsLRU.Add(Index);
+		DecodedBufferViewsCacheSize += DecodedBytes->Num();
+	}
+
+	Blob.Owner = DecodedBytes;
+	Blob.Data = DecodedBytes->GetData();
+	Blob.Num = DecodedBytes->Num();
+	return true;
+}
@@ -0,0 +1,1776 @@
+// Copyright 2020-2022, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "Async/ParallelFor.h"
+#include "Algo/Sort.h"
+#include "Algo/StableSort.h"
+
+namespace glTFRuntimePrimitives
+{
+	FORCEINLINE bool IsWithinEpsilon(const double A, const double B, const float Epsilon)
+	{
+		return FMath::Abs(A - B) <= FMath::Max(Epsilon, 0.f);
+	}
+
+	template<typename T>
+	bool HasAttribute(const TArray<T>& Attribute, const int32 NumVertices, bool& bValid)
+	{
+		if (Attribute.Num() > 0 && Attribute.Num() != NumVertices)
+		{
+			bValid = false;
+		}
+		return Attribute.Num() > 0;
+	}
+
+	template<typename T>
+	void Compact(TArray<T>& Attribute, const TArray<int32>& UniqueVertices)
+	{
+		if (Attribute.Num() == 0)
+		{
+			return;
+		}
+
+		TArray<T> CompactedAttribute;
+		CompactedAttribute.AddUninitialized(UniqueVertices.Num());
+		ParallelFor(UniqueVertices.Num(), [&](const int32 Index)
+			{
+				CompactedAttribute[Index] = Attribute[UniqueVertices[Index]];
+			});
+		Attribute = MoveTemp(CompactedAttribute);
+	}
+
+
+	// every attribute must have a value for each vertex (or no value at all) to be remapped
+	bool CanRemapVertices(const FglTFRuntimePrimitive& Primitive)
+	{
+		const int32 NumVertices = Primitive.Positions.Num();
+		bool bValid = true;
+		HasAttribute(Primitive.Normals, NumVertices, bValid);
+		HasAttribute(Primitive.Tangents, NumVertices, bValid);
+		HasAttribute(Primitive.Colors, NumVertices, bValid);
+		for (const TArray<FVector2D>& UV : Primitive.UVs)
+		{
+			bValid = bValid && UV.Num() == NumVertices;
+		}
+		for (const TArray<FglTFRuntimeUInt16Vector4>& Joints : Primitive.Joints)
+		{
+			bValid = bValid && Joints.Num() == NumVertices;
+		}
+		for (const TArray<FVector4>& Weights : Primitive.Weights)
+		{
+			bValid = bValid && Weights.Num() == NumVertices;
+		}
+		for (const FglTFRuntimeMorphTarget& MorphTarget : Primitive.MorphTargets)
+		{
+			HasAttribute(MorphTarget.Positions, NumVertices, bValid);
+			HasAttribute(MorphTarget.Normals, NumVertices, bValid);
+		}
+		return bValid;
+	}
+
+	// NewVertices[NewIndex] is the old index of each vertex to keep
+	void RemapVertices(FglTFRuntimePrimitive& Primitive, const TArray<int32>& NewVertices)
+	{
+		Compact(Primitive.Positions, NewVertices);
+		Compact(Primitive.Normals, NewVertices);
+		Compact(Primitive.Tangents, NewVertices);
+		Compact(Primitive.Colors, NewVertices);
+		for (TArray<FVector2D>& UV : Primitive.UVs)
+		{
+			Compact(UV, NewVertices);
+		}
+		for (TArray<FglTFRuntimeUInt16Vector4>& Joints : Primitive.Joints)
+		{
+			Compact(Joints, NewVertices);
+		}
+		for (TArray<FVector4>& Weights : Primitive.Weights)
+		{
+			Compact(Weights, NewVertices);
+		}
+		for (FglTFRuntimeMorphTarget& MorphTarget : Primitive.MorphTargets)
+		{
+			Compact(MorphTarget.Positions, NewVertices);
+			Compact(MorphTarget.Normals, NewVertices);
+		}
+	}
+
+	struct FWeldContext
+	{
+		const FglTFRuntimePrimitive& Primitive;
+		const float PositionEpsilon;
+		const float NormalEpsilon;
+		const float UVEpsilon;
+
+		FWeldContext(const FglTFRuntimePrimitive& InPrimitive, const float InPositionEpsilon, const float InNormalEpsilon, const float InUVEpsilon) :
+			Primitive(InPrimitive),
+			PositionEpsilon(InPositionEpsilon),
+			NormalEpsilon(InNormalEpsilon),
+			UVEpsilon(InUVEpsilon)
+		{
+		}
+
+		// positions are bucketed in a grid of epsilon sized cells, candidates are searched in the neighbouring cells too
+		// (vertices closer than epsilon can straddle a cell boundary) and then compared by their real distance
+		int64 GetCell(const double Value) const
+		{
+			const double CellSize = PositionEpsilon > 0 ? PositionEpsilon : 1.0;
+			return (int64)FMath::Clamp(FMath::FloorToDouble(Value / CellSize), -4.0e18, 4.0e18);
+		}
+
+		static uint32 HashCell(const int64 X, const int64 Y, const int64 Z)
+		{
+			return HashCombine(HashCombine(GetTypeHash(X), GetTypeHash(Y)), GetTypeHash(Z));
+		}
+
+		bool Match(const int32 A, const int32 B) const
+		{
+			auto MatchVector = [](const FVector& VectorA, const FVector& VectorB, const float Epsilon)
+			{
+				return IsWithinEpsilon(VectorA.X, VectorB.X, Epsilon) &&
+					IsWithinEpsilon(VectorA.Y, VectorB.Y, Epsilon) &&
+					IsWithinEpsilon(VectorA.Z, VectorB.Z, Epsilon);
+			};
+
+			if (!MatchVector(Primitive.Positions[A], Primitive.Positions[B], PositionEpsilon))
+			{
+				return false;
+			}
+
+			if (Primitive.Normals.Num() > 0 && !MatchVector(Primitive.Normals[A], Primitive.Normals[B], NormalEpsilon))
+			{
+				return false;
+			}
+
+			for (const TArray<FVector2D>& UV : Primitive.UVs)
+			{
+				if (!IsWithinEpsilon(UV[A].X, UV[B].X, UVEpsilon) || !IsWithinEpsilon(UV[A].Y, UV[B].Y, UVEpsilon))
+				{
+					return false;
+				}
+			}
+
+			// attributes without a tolerance must match exactly
+			if (Primitive.Tangents.Num() > 0 && Primitive.Tangents[A] != Primitive.Tangents[B])
+			{
+				return false;
+			}
+
+			if (Primitive.Colors.Num() > 0 && Primitive.Colors[A] != Primitive.Colors[B])
+			{
+				return false;
+			}
+
+			for (const TArray<FglTFRuntimeUInt16Vector4>& Joints : Primitive.Joints)
+			{
+				if (FMemory::Memcmp(&Joints[A], &Joints[B], sizeof(FglTFRuntimeUInt16Vector4)) != 0)
+				{
+					return false;
+				}
+			}
+
+			for (const TArray<FVector4>& Weights : Primitive.Weights)
+			{
+				if (Weights[A] != Weights[B])
+				{
+					return false;
+				}
+			}
+
+			for (const FglTFRuntimeMorphTarget& MorphTarget : Primitive.MorphTargets)
+			{
+				if ((MorphTarget.Positions.Num() > 0 && MorphTarget.Positions[A] != MorphTarget.Positions[B]) ||
+					(MorphTarget.Normals.Num() > 0 && MorphTarget.Normals[A] != MorphTarget.Normals[B]))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+	};
+
+	struct FConvexCluster
+	{
+		TArray<int32> Triangles;
+		FBox Bounds = FBox(ForceInit);
+		double Concavity = 0;
+		bool bCanSplit = true;
+	};
+
+	// concavity is estimated on a strided subset of the cluster triangles, big clusters would be too slow to evaluate otherwise
+	constexpr int32 MaxConcavitySamples = 256;
+
+	FORCEINLINE double BoxVolume(const FBox& Box)
+	{
+		if (!Box.IsValid)
+		{
+			return 0;
+		}
+		const FVector Size = Box.GetSize();
+		return static_cast<double>(Size.X) * Size.Y * Size.Z;
+	}
+
+	FORCEINLINE FBox TriangleBounds(const TArray<FVector>& Positions, const TArray<uint32>& Indices, const int32 TriangleIndex)
+	{
+		FBox Box(ForceInit);
+		Box += Positions[Indices[TriangleIndex * 3]];
+		Box += Positions[Indices[TriangleIndex * 3 + 1]];
+		Box += Positions[Indices[TriangleIndex * 3 + 2]];
+		return Box;
+	}
+
+	// the 6 axis plus a fibonacci sphere
+	void GetHullDirections(const int32 NumDirections, TArray<FVector>& Directions)
+	{
+		Directions = { FVector(1, 0, 0), FVector(-1, 0, 0), FVector(0, 1, 0), FVector(0, -1, 0), FVector(0, 0, 1), FVector(0, 0, -1) };
+		for (int32 DirectionIndex = 0; DirectionIndex < NumDirections; DirectionIndex++)
+		{
+			const double Z = 1 - (2 * (DirectionIndex + 0.5)) / NumDirections;
+			const double Radius = FMath::Sqrt(FMath::Max(1 - Z * Z, 0.0));
+			const double Angle = DirectionIndex * PI * (3 - FMath::Sqrt(5.0));
+			Directions.Add(FVector(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius, Z));
+		}
+	}
+
+	void AddConcavitySamples(const TArray<FVector>& Positions, const TArray<uint32>& Indices, const TArray<FVector>& Centroids, const int32 TriangleIndex, TArray<FVector>& Points)
+	{
+		Points.Add(Positions[Indices[TriangleIndex * 3]]);
+		Points.Add(Positions[Indices[TriangleIndex * 3 + 1]]);
+		Points.Add(Positions[Indices[TriangleIndex * 3 + 2]]);
+		Points.Add(Centroids[TriangleIndex]);
+	}
+
+	// the hull is approximated by its supporting planes along the given directions (a k-DOP),
+	// the concavity is the depth of the deepest point below them: 0 for a convex surface (up to the directions sampling),
+	// the size of the cavity for a concave one
+	double ComputeConcavity(const TArray<FVector>& Points, const TArray<FVector>& Directions)
+	{
+		if (Points.Num() < 4)
+		{
+			return 0;
+		}
+
+		TArray<double> Support;
+		Support.Init(TNumericLimits<double>::Lowest(), Directions.Num());
+		for (const FVector& Point : Points)
+		{
+			for (int32 DirectionIndex = 0; DirectionIndex < Directions.Num(); DirectionIndex++)
+			{
+				Support[DirectionIndex] = FMath::Max(Support[DirectionIndex], static_cast<double>(FVector::DotProduct(Point, Directions[DirectionIndex])));
+			}
+		}
+
+		double Concavity = 0;
+		for (const FVector& Point : Points)
+		{
+			double Depth = TNumericLimits<double>::Max();
+			for (int32 DirectionIndex = 0; DirectionIndex < Directions.Num() && Depth > Concavity; DirectionIndex++)
+			{
+				Depth = FMath::Min(Depth, Support[DirectionIndex] - FVector::DotProduct(Point, Directions[DirectionIndex]));
+			}
+			Concavity = FMath::Max(Concavity, Depth);
+		}
+
+		return Concavity;
+	}
+
+	void InitCluster(const TArray<FVector>& Positions, const TArray<uint32>& Indices, const TArray<FVector>& Centroids, const TArray<FVector>& Directions, FConvexCluster& Cluster)
+	{
+		Cluster.Bounds = FBox(ForceInit);
+		for (const int32 TriangleIndex : Cluster.Triangles)
+		{
+			Cluster.Bounds += TriangleBounds(Positions, Indices, TriangleIndex);
+		}
+
+		TArray<FVector> Points;
+		const int32 Stride = FMath::Max(Cluster.Triangles.Num() / MaxConcavitySamples, 1);
+		for (int32 Index = 0; Index < Cluster.Triangles.Num(); Index += Stride)
+		{
+			AddConcavitySamples(Positions, Indices, Centroids, Cluster.Triangles[Index], Points);
+		}
+
+		Cluster.Concavity = ComputeConcavity(Points, Directions);
+		Cluster.bCanSplit = Cluster.Triangles.Num() > 1;
+	}
+
+	// the cluster is cut by one of the planes evenly distributed along each axis of its centroids bounds,
+	// the winning plane is the one leaving the lowest concavity in the two halves (the smallest volume breaks the ties)
+	bool SplitCluster(const TArray<FVector>& Positions, const TArray<uint32>& Indices, const TArray<FVector>& Centroids, const TArray<FVector>& Directions, const FConvexCluster& Cluster, const int32 SplitPlanes, FConvexCluster& Left, FConvexCluster& Right)
+	{
+		FBox CentroidsBounds(ForceInit);
+		for (const int32 TriangleIndex : Cluster.Triangles)
+		{
+			CentroidsBounds += Centroids[TriangleIndex];
+		}
+
+		const int32 NumBins = SplitPlanes + 1;
+		auto GetBin = [&](const int32 TriangleIndex, const int32 Axis)
+		{
+			const double Extent = CentroidsBounds.Max[Axis] - CentroidsBounds.Min[Axis];
+			return FMath::Clamp(static_cast<int32>((Centroids[TriangleIndex][Axis] - CentroidsBounds.Min[Axis]) / Extent * NumBins), 0, NumBins - 1);
+		};
+
+		TArray<int32> SampleTriangles;
+		const int32 Stride = FMath::Max(Cluster.Triangles.Num() / MaxConcavitySamples, 1);
+		for (int32 Index = 0; Index < Cluster.Triangles.Num(); Index += Stride)
+		{
+			SampleTriangles.Add(Cluster.Triangles[Index]);
+		}
+
+		struct FSplitCandidate
+		{
+			double Concavity = TNumericLimits<double>::Max();
+			double Volume = TNumericLimits<double>::Max();
+		};
+
+		TArray<FSplitCandidate> Candidates;
+		Candidates.AddDefaulted(3 * SplitPlanes);
+		ParallelFor(Candidates.Num(), [&](const int32 CandidateIndex)
+			{
+				const int32 Axis = CandidateIndex / SplitPlanes;
+				const int32 Plane = CandidateIndex % SplitPlanes;
+				if (CentroidsBounds.Max[Axis] - CentroidsBounds.Min[Axis] <= KINDA_SMALL_NUMBER)
+				{
+					return;
+				}
+
+				TArray<FVector> LeftPoints;
+				TArray<FVector> RightPoints;
+				FBox LeftBounds(ForceInit);
+				FBox RightBounds(ForceInit);
+				for (const int32 TriangleIndex : SampleTriangles)
+				{
+					if (GetBin(TriangleIndex, Axis) <= Plane)
+					{
+						AddConcavitySamples(Positions, Indices, Centroids, TriangleIndex, LeftPoints);
+						LeftBounds += TriangleBounds(Positions, Indices, TriangleIndex);
+					}
+					else
+					{
+						AddConcavitySamples(Positions, Indices, Centroids, TriangleIndex, RightPoints);
+						RightBounds += TriangleBounds(Positions, Indices, TriangleIndex);
+					}
+				}
+
+				if (LeftPoints.Num() == 0 || RightPoints.Num() == 0)
+				{
+					return;
+				}
+
+				Candidates[CandidateIndex].Concavity = ComputeConcavity(LeftPoints, Directions) + ComputeConcavity(RightPoints, Directions);
+				Candidates[CandidateIndex].Volume = BoxVolume(LeftBounds) + BoxVolume(RightBounds);
+			});
+
+		// splitting is useful only if it removes concavity
+		const double Tolerance = Cluster.Concavity * 0.01;
+		int32 BestCandidate = INDEX_NONE;
+		for (int32 CandidateIndex = 0; CandidateIndex < Candidates.Num(); CandidateIndex++)
+		{
+			const FSplitCandidate& Candidate = Candidates[CandidateIndex];
+			if (Candidate.Concavity >= Cluster.Concavity - Tolerance)
+			{
+				continue;
+			}
+
+			if (BestCandidate == INDEX_NONE || Candidate.Concavity < Candidates[BestCandidate].Concavity - Tolerance ||
+				(Candidate.Concavity <= Candidates[BestCandidate].Concavity + Tolerance && Candidate.Volume < Candidates[BestCandidate].Volume))
+			{
+				BestCandidate = CandidateIndex;
+			}
+		}
+
+		if (BestCandidate == INDEX_NONE)
+		{
+			return false;
+		}
+
+		const int32 BestAxis = BestCandidate / SplitPlanes;
+		const int32 BestPlane = BestCandidate % SplitPlanes;
+		for (const int32 TriangleIndex : Cluster.Triangles)
+		{
+			if (GetBin(TriangleIndex, BestAxis) <= BestPlane)
+			{
+				Left.Triangles.Add(TriangleIndex);
+			}
+			else
+			{
+				Right.Triangles.Add(TriangleIndex);
+			}
+		}
+
+		// the sampled triangles were all on one side, but the whole cluster may not be
+		if (Left.Triangles.Num() == 0 || Right.Triangles.Num() == 0)
+		{
+			return false;
+		}
+
+		InitCluster(Positions, Indices, Centroids, Directions, Left);
+		InitCluster(Positions, Indices, Centroids, Directions, Right);
+		return true;
+	}
+
+	// the physics cooker builds the hull from the points, here we only pick a well distributed subset of the extreme ones
+	void BuildHull(const TArray<FVector>& Positions, const TArray<uint32>& Indices, const FConvexCluster& Cluster, const int32 MaxHullVertices, TArray<FVector>& Hull)
+	{
+		TSet<uint32> UniqueVertices;
+		FVector PlaneNormal = FVector::ZeroVector;
+		double MaxArea = 0;
+		for (const int32 TriangleIndex : Cluster.Triangles)
+		{
+			const FVector& Position0 = Positions[Indices[TriangleIndex * 3]];
+			const FVector& Position1 = Positions[Indices[TriangleIndex * 3 + 1]];
+			const FVector& Position2 = Positions[Indices[TriangleIndex * 3 + 2]];
+			const FVector Cross = FVector::CrossProduct(Position1 - Position0, Position2 - Position0);
+			if (Cross.SizeSquared() > MaxArea)
+			{
+				MaxArea = Cross.SizeSquared();
+				PlaneNormal = Cross.GetSafeNormal();
+			}
+			UniqueVertices.Add(Indices[TriangleIndex * 3]);
+			UniqueVertices.Add(Indices[TriangleIndex * 3 + 1]);
+			UniqueVertices.Add(Indices[TriangleIndex * 3 + 2]);
+		}
+
+		TArray<FVector> Points;
+		Points.Reserve(UniqueVertices.Num());
+		double PlaneMin = TNumericLimits<double>::Max();
+		double PlaneMax = TNumericLimits<double>::Lowest();
+		for (const uint32 VertexIndex : UniqueVertices)
+		{
+			Points.Add(Positions[VertexIndex]);
+			const double Distance = FVector::DotProduct(Positions[VertexIndex], PlaneNormal);
+			PlaneMin = FMath::Min(PlaneMin, Distance);
+			PlaneMax = FMath::Max(PlaneMax, Distance);
+		}
+
+		// flat clusters are extruded a bit, the cooker cannot build a hull from coplanar points
+		// (the thickness follows the cluster size, so it is meaningful at any mesh scale)
+		const double MinThickness = FMath::Max(static_cast<double>(Cluster.Bounds.GetSize().GetMax()) * 0.01, static_cast<double>(KINDA_SMALL_NUMBER));
+		const bool bFlat = PlaneMax - PlaneMin < MinThickness;
+		const int32 MaxPoints = bFlat ? FMath::Max(MaxHullVertices / 2, 3) : MaxHullVertices;
+
+		if (Points.Num() <= MaxPoints)
+		{
+			Hull = MoveTemp(Points);
+		}
+		else
+		{
+			TArray<FVector> Directions;
+			GetHullDirections(MaxPoints * 4, Directions);
+
+			TSet<int32> Selected;
+			for (const FVector& Direction : Directions)
+			{
+				int32 BestPoint = 0;
+				double BestDistance = TNumericLimits<double>::Lowest();
+				for (int32 PointIndex = 0; PointIndex < Points.Num(); PointIndex++)
+				{
+					const double Distance = FVector::DotProduct(Points[PointIndex], Direction);
+					if (Distance > BestDistance)
+					{
+						BestDistance = Distance;
+						BestPoint = PointIndex;
+					}
+				}
+
+				if (!Selected.Contains(BestPoint))
+				{
+					Selected.Add(BestPoint);
+					Hull.Add(Points[BestPoint]);
+					if (Hull.Num() >= MaxPoints)
+					{
+						break;
+					}
+				}
+			}
+		}
+
+		if (bFlat)
+		{
+			const int32 NumPoints = Hull.Num();
+			const FVector Offset = PlaneNormal * (MinThickness - (PlaneMax - PlaneMin));
+			for (int32 PointIndex = 0; PointIndex < NumPoints; PointIndex++)
+			{
+				Hull.Add(Hull[PointIndex] + Offset);
+			}
+		}
+	}
+
+	// average cache miss ratio of a FIFO post transform cache
+	float ComputeACMR(const TArray<uint32>& Indices, const int32 NumVertices, const int32 CacheSize = 16)
+	{
+		const int32 NumTriangles = Indices.Num() / 3;
+		if (NumTriangles == 0)
+		{
+			return 0;
+		}
+
+		TArray<uint32> Timestamps;
+		Timestamps.AddZeroed(NumVertices);
+		uint32 Time = CacheSize + 1;
+		int32 Misses = 0;
+		for (const uint32 VertexIndex : Indices)
+		{
+			if (Time - Timestamps[VertexIndex] > static_cast<uint32>(CacheSize))
+			{
+				Timestamps[VertexIndex] = Time++;
+				Misses++;
+			}
+		}
+
+		return static_cast<float>(Misses) / NumTriangles;
+	}
+
+	// Tipsify (Sander, Nehab, Barczak - Fast Triangle Reordering for Vertex Locality and Reduced Overdraw)
+	void OptimizeVertexCache(TArray<uint32>& Indices, const int32 NumVertices, const int32 CacheSize = 16)
+	{
+		const int32 NumTriangles = Indices.Num() / 3;
+
+		TArray<int32> LiveTriangles;
+		LiveTriangles.AddZeroed(NumVertices);
+		for (const uint32 VertexIndex : Indices)
+		{
+			LiveTriangles[VertexIndex]++;
+		}
+
+		// vertex -> triangles adjacency
+		TArray<int32> AdjacencyOffsets;
+		AdjacencyOffsets.AddUninitialized(NumVertices + 1);
+		AdjacencyOffsets[0] = 0;
+		for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+		{
+			AdjacencyOffsets[VertexIndex + 1] = AdjacencyOffsets[VertexIndex] + LiveTriangles[VertexIndex];
+		}
+
+		TArray<int32> Adjacency;
+		Adjacency.AddUninitialized(Indices.Num());
+		TArray<int32> AdjacencyCursor = AdjacencyOffsets;
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+		{
+			for (int32 Corner = 0; Corner < 3; Corner++)
+			{
+				Adjacency[AdjacencyCursor[Indices[TriangleIndex * 3 + Corner]]++] = TriangleIndex;
+			}
+		}
+
+		TArray<uint32> Timestamps;
+		Timestamps.AddZeroed(NumVertices);
+		TArray<bool> EmittedTriangles;
+		EmittedTriangles.AddZeroed(NumTriangles);
+		TArray<uint32> DeadEnd;
+		TArray<uint32> Candidates;
+		TArray<uint32> OptimizedIndices;
+		OptimizedIndices.Reserve(Indices.Num());
+
+		uint32 Time = CacheSize + 1;
+		int32 Cursor = 0;
+
+		auto SkipDeadEnd = [&]() -> int32
+		{
+			while (DeadEnd.Num() > 0)
+			{
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION > 3)
+				const uint32 VertexIndex = DeadEnd.Pop(EAllowShrinking::No);
+#else
+				const uint32 VertexIndex = DeadEnd.Pop(false);
+#endif
+				if (LiveTriangles[VertexIndex] > 0)
+				{
+					return VertexIndex;
+				}
+			}
+
+			while (Cursor < NumVertices)
+			{
+				if (LiveTriangles[Cursor] > 0)
+				{
+					return Cursor;
+				}
+				Cursor++;
+			}
+
+			return INDEX_NONE;
+		};
+
+		int32 FanningVertex = SkipDeadEnd();
+		while (FanningVertex != INDEX_NONE)
+		{
+			Candidates.Reset();
+			for (int32 AdjacencyIndex = AdjacencyOffsets[FanningVertex]; AdjacencyIndex < AdjacencyOffsets[FanningVertex + 1]; AdjacencyIndex++)
+			{
+				const int32 TriangleIndex = Adjacency[AdjacencyIndex];
+				if (EmittedTriangles[TriangleIndex])
+				{
+					continue;
+				}
+
+				for (int32 Corner = 0; Corner < 3; Corner++)
+				{
+					const uint32 VertexIndex = Indices[TriangleIndex * 3 + Corner];
+					OptimizedIndices.Add(VertexIndex);
+					DeadEnd.Add(VertexIndex);
+					Candidates.Add(VertexIndex);
+					LiveTriangles[VertexIndex]--;
+					if (Time - Timestamps[VertexIndex] > static_cast<uint32>(CacheSize))
+					{
+						Timestamps[VertexIndex] = Time++;
+					}
+				}
+				EmittedTriangles[TriangleIndex] = true;
+			}
+
+			// prefer the candidate that will still be in cache after emitting all of its triangles
+			int32 NextVertex = INDEX_NONE;
+			int32 BestPriority = -1;
+			for (const uint32 VertexIndex : Candidates)
+			{
+				if (LiveTriangles[VertexIndex] <= 0)
+				{
+					continue;
+				}
+
+				int32 Priority = 0;
+				if (Time - Timestamps[VertexIndex] + 2 * LiveTriangles[VertexIndex] <= static_cast<uint32>(CacheSize))
+				{
+					Priority = Time - Timestamps[VertexIndex];
+				}
+
+				if (Priority > BestPriority)
+				{
+					BestPriority = Priority;
+					NextVertex = VertexIndex;
+				}
+			}
+
+			FanningVertex = NextVertex != INDEX_NONE ? NextVertex : SkipDeadEnd();
+		}
+
+		Indices = MoveTemp(OptimizedIndices);
+	}
+
+	// split the (cache optimized) triangles in clusters and draw first the ones facing outside, they are the most likely occluders
+	void OptimizeOverdraw(TArray<uint32>& Indices, const TArray<FVector>& Positions, const float Threshold, const int32 CacheSize = 16)
+	{
+		const int32 NumTriangles = Indices.Num() / 3;
+		const int32 NumVertices = Positions.Num();
+
+		TArray<uint32> Timestamps;
+		Timestamps.AddZeroed(NumVertices);
+		uint32 Time = CacheSize + 1;
+
+		auto TriangleMisses = [&](const int32 TriangleIndex)
+		{
+			int32 Misses = 0;
+			for (int32 Corner = 0; Corner < 3; Corner++)
+			{
+				const uint32 VertexIndex = Indices[TriangleIndex * 3 + Corner];
+				if (Time - Timestamps[VertexIndex] > static_cast<uint32>(CacheSize))
+				{
+					Timestamps[VertexIndex] = Time++;
+					Misses++;
+				}
+			}
+			return Misses;
+		};
+
+		auto FlushCache = [&]()
+		{
+			Time += CacheSize + 1;
+		};
+
+		// hard boundaries: the cache has been completely missed
+		TArray<int32> HardBoundaries;
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+		{
+			if (TriangleMisses(TriangleIndex) == 3)
+			{
+				HardBoundaries.Add(TriangleIndex);
+			}
+		}
+		HardBoundaries.Add(NumTriangles);
+
+		// soft boundaries: split when the running ACMR gets close enough to the cluster one
+		TArray<int32> Boundaries;
+		for (int32 HardIndex = 0; HardIndex < HardBoundaries.Num() - 1; HardIndex++)
+		{
+			const int32 Start = HardBoundaries[HardIndex];
+			const int32 End = HardBoundaries[HardIndex + 1];
+
+			FlushCache();
+			int32 ClusterMisses = 0;
+			for (int32 TriangleIndex = Start; TriangleIndex < End; TriangleIndex++)
+			{
+				ClusterMisses += TriangleMisses(TriangleIndex);
+			}
+			const float ClusterACMR = static_cast<float>(ClusterMisses) / (End - Start);
+
+			Boundaries.Add(Start);
+			FlushCache();
+			int32 Misses = 0;
+			int32 Triangles = 0;
+			for (int32 TriangleIndex = Start; TriangleIndex < End; TriangleIndex++)
+			{
+				Misses += TriangleMisses(TriangleIndex);
+				Triangles++;
+				if (TriangleIndex + 1 < End && static_cast<float>(Misses) / Triangles <= ClusterACMR * Threshold)
+				{
+					Boundaries.Add(TriangleIndex + 1);
+					FlushCache();
+					Misses = 0;
+					Triangles = 0;
+				}
+			}
+		}
+
+		if (Boundaries.Num() < 2)
+		{
+			return;
+		}
+
+		FVector MeshCentroid = FVector::ZeroVector;
+		for (const uint32 VertexIndex : Indices)
+		{
+			MeshCentroid += Positions[VertexIndex];
+		}
+		MeshCentroid /= Indices.Num();
+
+		struct FCluster
+		{
+			int32 Start;
+			int32 End;
+			float SortKey;
+		};
+
+		TArray<FCluster> Clusters;
+		Clusters.AddUninitialized(Boundaries.Num());
+		for (int32 ClusterIndex = 0; ClusterIndex < Boundaries.Num(); ClusterIndex++)
+		{
+			FCluster& Cluster = Clusters[ClusterIndex];
+			Cluster.Start = Boundaries[ClusterIndex];
+			Cluster.End = ClusterIndex + 1 < Boundaries.Num() ? Boundaries[ClusterIndex + 1] : NumTriangles;
+
+			FVector ClusterCentroid = FVector::ZeroVector;
+			FVector ClusterNormal = FVector::ZeroVector;
+			double ClusterArea = 0;
+			for (int32 TriangleIndex = Cluster.Start; TriangleIndex < Cluster.End; TriangleIndex++)
+			{
+				const FVector& Position0 = Positions[Indices[TriangleIndex * 3]];
+				const FVector& Position1 = Positions[Indices[TriangleIndex * 3 + 1]];
+				const FVector& Position2 = Positions[Indices[TriangleIndex * 3 + 2]];
+				// same orientation used for generating flat normals
+				const FVector Cross = FVector::CrossProduct(Position2 - Position0, Position1 - Position0);
+				const double Area = Cross.Size();
+				ClusterCentroid += (Position0 + Position1 + Position2) / 3 * Area;
+				ClusterNormal += Cross;
+				ClusterArea += Area;
+			}
+
+			if (ClusterArea > 0)
+			{
+				ClusterCentroid /= ClusterArea;
+			}
+
+			Cluster.SortKey = FVector::DotProduct(ClusterCentroid - MeshCentroid, ClusterNormal.GetSafeNormal());
+		}
+
+		Algo::StableSortBy(Clusters, [](const FCluster& Cluster) { return -Cluster.SortKey; });
+
+		TArray<uint32> SortedIndices;
+		SortedIndices.Reserve(Indices.Num());
+		for (const FCluster& Cluster : Clusters)
+		{
+			SortedIndices.Append(Indices.GetData() + Cluster.Start * 3, (Cluster.End - Cluster.Start) * 3);
+		}
+		Indices = MoveTemp(SortedIndices);
+	}
+
+	// vertices are reordered by first use, unreferenced ones go to the end
+	void OptimizeVertexFetch(FglTFRuntimePrimitive& Primitive)
+	{
+		const int32 NumVertices = Primitive.Positions.Num();
+
+		TArray<int32> Remap;
+		Remap.Init(INDEX_NONE, NumVertices);
+		TArray<int32> NewVertices;
+		NewVertices.Reserve(NumVertices);
+		for (uint32& VertexIndex : Primitive.Indices)
+		{
+			if (Remap[VertexIndex] == INDEX_NONE)
+			{
+				Remap[VertexIndex] = NewVertices.Add(VertexIndex);
+			}
+			VertexIndex = Remap[VertexIndex];
+		}
+
+		for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+		{
+			if (Remap[VertexIndex] == INDEX_NONE)
+			{
+				Remap[VertexIndex] = NewVertices.Add(VertexIndex);
+			}
+		}
+
+		RemapVertices(Primitive, NewVertices);
+	}
+
+
+	struct FQuadric
+	{
+		double A00 = 0;
+		double A01 = 0;
+		double A02 = 0;
+		double A11 = 0;
+		double A12 = 0;
+		double A22 = 0;
+		double B0 = 0;
+		double B1 = 0;
+		double B2 = 0;
+		double C = 0;
+
+		void AddPlane(const FVector& Normal, const double Distance, const double Weight)
+		{
+			A00 += Weight * Normal.X * Normal.X;
+			A01 += Weight * Normal.X * Normal.Y;
+			A02 += Weight * Normal.X * Normal.Z;
+			A11 += Weight * Normal.Y * Normal.Y;
+			A12 += Weight * Normal.Y * Normal.Z;
+			A22 += Weight * Normal.Z * Normal.Z;
+			B0 += Weight * Normal.X * Distance;
+			B1 += Weight * Normal.Y * Distance;
+			B2 += Weight * Normal.Z * Distance;
+			C += Weight * Distance * Distance;
+		}
+
+		void Add(const FQuadric& Other)
+		{
+			A00 += Other.A00;
+			A01 += Other.A01;
+			A02 += Other.A02;
+			A11 += Other.A11;
+			A12 += Other.A12;
+			A22 += Other.A22;
+			B0 += Other.B0;
+			B1 += Other.B1;
+			B2 += Other.B2;
+			C += Other.C;
+		}
+
+		double Error(const FVector& Position) const
+		{
+			const double X = Position.X;
+			const double Y = Position.Y;
+			const double Z = Position.Z;
+			return A00 * X * X + A11 * Y * Y + A22 * Z * Z + 2 * (A01 * X * Y + A02 * X * Z + A12 * Y * Z) + 2 * (B0 * X + B1 * Y + B2 * Z) + C;
+		}
+	};
+
+	// vertices on borders or non-manifold edges never move, so the silhouette is preserved
+	// vertices sharing the same position (attribute seams) are grouped, the simplifier moves a group as a whole
+	void FindLockedVertices(const FglTFRuntimePrimitive& Primitive, TArray<bool>& Locked, TArray<int32>& PositionGroups, TArray<int32>& PositionGroupsSize)
+	{
+		const int32 NumVertices = Primitive.Positions.Num();
+		Locked.Init(false, NumVertices);
+
+		PositionGroups.SetNumUninitialized(NumVertices);
+		PositionGroupsSize.Reset();
+		TMap<FVector, int32> PositionsMap;
+		for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+		{
+			if (const int32* Group = PositionsMap.Find(Primitive.Positions[VertexIndex]))
+			{
+				PositionGroups[VertexIndex] = *Group;
+				PositionGroupsSize[*Group]++;
+			}
+			else
+			{
+				PositionGroups[VertexIndex] = PositionGroupsSize.Add(1);
+				PositionsMap.Add(Primitive.Positions[VertexIndex], PositionGroups[VertexIndex]);
+			}
+		}
+
+		TMap<uint64, int32> EdgesCount;
+		const int32 NumTriangles = Primitive.Indices.Num() / 3;
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+		{
+			for (int32 Corner = 0; Corner < 3; Corner++)
+			{
+				const uint32 GroupA = PositionGroups[Primitive.Indices[TriangleIndex * 3 + Corner]];
+				const uint32 GroupB = PositionGroups[Primitive.Indices[TriangleIndex * 3 + (Corner + 1) % 3]];
+				EdgesCount.FindOrAdd((static_cast<uint64>(FMath::Min(GroupA, GroupB)) << 32) | FMath::Max(GroupA, GroupB))++;
+			}
+		}
+
+		TArray<bool> LockedGroups;
+		LockedGroups.Init(false, PositionGroupsSize.Num());
+		for (const TPair<uint64, int32>& Pair : EdgesCount)
+		{
+			if (Pair.Value != 2)
+			{
+				LockedGroups[Pair.Key >> 32] = true;
+				LockedGroups[Pair.Key & 0xFFFFFFFF] = true;
+			}
+		}
+
+		for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+		{
+			const int32 Group = PositionGroups[VertexIndex];
+			Locked[VertexIndex] = LockedGroups[Group];
+		}
+	}
+
+}
+
+bool FglTFRuntimeParser::WeldPrimitive(FglTFRuntimePrimitive& Primitive, const float PositionEpsilon, const float NormalEpsilon, const float UVEpsilon)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_WeldPrimitive, FColor::Magenta);
+
+	const int32 NumVertices = Primitive.Positions.Num();
+	if (!Primitive.bHasSynthesizedIndices || NumVertices == 0 || Primitive.Indices.Num() != NumVertices)
+	{
+		return false;
+	}
+
+	if (!glTFRuntimePrimitives::CanRemapVertices(Primitive))
+	{
+		return false;
+	}
+
+	const glTFRuntimePrimitives::FWeldContext WeldContext(Primitive, PositionEpsilon, NormalEpsilon, UVEpsilon);
+
+	TArray<int64> Cells;
+	Cells.AddUninitialized(NumVertices * 3);
+	ParallelFor(NumVertices, [&](const int32 VertexIndex)
+		{
+			const FVector& Position = Primitive.Positions[VertexIndex];
+			Cells[VertexIndex * 3] = WeldContext.GetCell(Position.X);
+			Cells[VertexIndex * 3 + 1] = WeldContext.GetCell(Position.Y);
+			Cells[VertexIndex * 3 + 2] = WeldContext.GetCell(Position.Z);
+		});
+
+	TArray<int32> Remap;
+	Remap.AddUninitialized(NumVertices);
+	TArray<int32> UniqueVertices;
+	TMultiMap<uint32, int32> UniqueVerticesMap;
+	UniqueVerticesMap.Reserve(NumVertices);
+
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		const int64* Cell = &Cells[VertexIndex * 3];
+		int32 WeldedIndex = INDEX_NONE;
+		for (int32 Neighbour = 0; Neighbour < 27 && WeldedIndex == INDEX_NONE; Neighbour++)
+		{
+			const uint32 CellHash = glTFRuntimePrimitives::FWeldContext::HashCell(Cell[0] + (Neighbour % 3) - 1, Cell[1] + ((Neighbour / 3) % 3) - 1, Cell[2] + (Neighbour / 9) - 1);
+			for (TMultiMap<uint32, int32>::TConstKeyIterator It = UniqueVerticesMap.CreateConstKeyIterator(CellHash); It; ++It)
+			{
+				if (WeldContext.Match(UniqueVertices[It.Value()], VertexIndex))
+				{
+					WeldedIndex = It.Value();
+					break;
+				}
+			}
+		}
+
+		if (WeldedIndex == INDEX_NONE)
+		{
+			WeldedIndex = UniqueVertices.Add(VertexIndex);
+			UniqueVerticesMap.Add(glTFRuntimePrimitives::FWeldContext::HashCell(Cell[0], Cell[1], Cell[2]), WeldedIndex);
+		}
+
+		Remap[VertexIndex] = WeldedIndex;
+	}
+
+	UE_LOG(LogGLTFRuntime, Verbose, TEXT("Welded primitive vertices: %d -> %d"), NumVertices, UniqueVertices.Num());
+
+	if (UniqueVertices.Num() == NumVertices)
+	{
+		return true;
+	}
+
+	glTFRuntimePrimitives::RemapVertices(Primitive, UniqueVertices);
+
+	ParallelFor(Primitive.Indices.Num(), [&](const int32 Index)
+		{
+			Primitive.Indices[Index] = Remap[Primitive.Indices[Index]];
+		});
+
+	Primitive.bHasSynthesizedIndices = false;
+
+	return true;
+}
+
+void FglTFRuntimeParser::DecomposeConvex(const TArray<FVector>& Positions, const TArray<uint32>& Indices, const int32 MaxHulls, const int32 MaxHullVertices, const float MaxConcavity, const int32 SplitPlanes, TArray<TArray<FVector>>& Hulls)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_DecomposeConvex, FColor::Magenta);
+
+	const int32 NumTriangles = Indices.Num() / 3;
+	if (NumTriangles == 0)
+	{
+		return;
+	}
+
+	TArray<FVector> Centroids;
+	Centroids.AddUninitialized(NumTriangles);
+	for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+	{
+		Centroids[TriangleIndex] = (Positions[Indices[TriangleIndex * 3]] + Positions[Indices[TriangleIndex * 3 + 1]] + Positions[Indices[TriangleIndex * 3 + 2]]) / 3;
+	}
+
+	TArray<FVector> Directions;
+	glTFRuntimePrimitives::GetHullDirections(64, Directions);
+
+	TArray<glTFRuntimePrimitives::FConvexCluster> Clusters;
+	glTFRuntimePrimitives::FConvexCluster& RootCluster = Clusters.AddDefaulted_GetRef();
+	RootCluster.Triangles.AddUninitialized(NumTriangles);
+	for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+	{
+		RootCluster.Triangles[TriangleIndex] = TriangleIndex;
+	}
+	glTFRuntimePrimitives::InitCluster(Positions, Indices, Centroids, Directions, RootCluster);
+
+	// the concavity threshold is relative to the whole mesh, so the result does not depend on its scale
+	const double ConcavityThreshold = FMath::Max(static_cast<double>(MaxConcavity), 0.0) * RootCluster.Bounds.GetSize().Size();
+
+	// always split the most concave cluster, until all of them are convex enough or the hulls budget is exhausted
+	while (Clusters.Num() < FMath::Max(MaxHulls, 1))
+	{
+		int32 ClusterToSplit = INDEX_NONE;
+		for (int32 ClusterIndex = 0; ClusterIndex < Clusters.Num(); ClusterIndex++)
+		{
+			if (Clusters[ClusterIndex].bCanSplit && Clusters[ClusterIndex].Concavity > ConcavityThreshold && (ClusterToSplit == INDEX_NONE || Clusters[ClusterIndex].Concavity > Clusters[ClusterToSplit].Concavity))
+			{
+				ClusterToSplit = ClusterIndex;
+			}
+		}
+
+		if (ClusterToSplit == INDEX_NONE)
+		{
+			break;
+		}
+
+		glTFRuntimePrimitives::FConvexCluster Left;
+		glTFRuntimePrimitives::FConvexCluster Right;
+		if (!glTFRuntimePrimitives::SplitCluster(Positions, Indices, Centroids, Directions, Clusters[ClusterToSplit], FMath::Max(SplitPlanes, 1), Left, Right))
+		{
+			Clusters[ClusterToSplit].bCanSplit = false;
+			continue;
+		}
+
+		Clusters[ClusterToSplit] = MoveTemp(Left);
+		Clusters.Add(MoveTemp(Right));
+	}
+
+	const int32 FirstHull = Hulls.Num();
+	Hulls.AddDefaulted(Clusters.Num());
+	ParallelFor(Clusters.Num(), [&](const int32 ClusterIndex)
+		{
+			glTFRuntimePrimitives::BuildHull(Positions, Indices, Clusters[ClusterIndex], FMath::Clamp(MaxHullVertices, 4, 255), Hulls[FirstHull + ClusterIndex]);
+		});
+}
+
+bool FglTFRuntimeParser::OptimizePrimitive(FglTFRuntimePrimitive& Primitive, const bool bVertexCache, const bool bOverdraw, const float OverdrawThreshold, const bool bVertexFetch)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_OptimizePrimitive, FColor::Magenta);
+
+	const int32 NumVertices = Primitive.Positions.Num();
+	if (NumVertices == 0 || Primitive.Indices.Num() == 0 || (Primitive.Indices.Num() % 3) != 0)
+	{
+		return false;
+	}
+
+	for (const uint32 VertexIndex : Primitive.Indices)
+	{
+		if (VertexIndex >= static_cast<uint32>(NumVertices))
+		{
+			return false;
+		}
+	}
+
+	const float ACMR = glTFRuntimePrimitives::ComputeACMR(Primitive.Indices, NumVertices);
+
+	if (bVertexCache)
+	{
+		glTFRuntimePrimitives::OptimizeVertexCache(Primitive.Indices, NumVertices);
+	}
+
+	if (bOverdraw)
+	{
+		glTFRuntimePrimitives::OptimizeOverdraw(Primitive.Indices, Primitive.Positions, FMath::Max(OverdrawThreshold, 1.0f));
+	}
+
+	if (bVertexFetch && glTFRuntimePrimitives::CanRemapVertices(Primitive))
+	{
+		glTFRuntimePrimitives::OptimizeVertexFetch(Primitive);
+	}
+
+	UE_LOG(LogGLTFRuntime, Verbose, TEXT("Optimized primitive ACMR: %f -> %f"), ACMR, glTFRuntimePrimitives::ComputeACMR(Primitive.Indices, NumVertices));
+
+	return true;
+}
+
+bool FglTFRuntimeParser::SimplifyPrimitive(const FglTFRuntimePrimitive& Primitive, const float TriangleRatio, FglTFRuntimePrimitive& SimplifiedPrimitive)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_SimplifyPrimitive, FColor::Magenta);
+
+	SimplifiedPrimitive = Primitive;
+
+	const int32 NumVertices = Primitive.Positions.Num();
+	if (TriangleRatio >= 1 || NumVertices == 0 || Primitive.Indices.Num() == 0 || (Primitive.Indices.Num() % 3) != 0 || !glTFRuntimePrimitives::CanRemapVertices(Primitive))
+	{
+		return false;
+	}
+
+	for (const uint32 VertexIndex : Primitive.Indices)
+	{
+		if (VertexIndex >= static_cast<uint32>(NumVertices))
+		{
+			return false;
+		}
+	}
+
+	const TArray<FVector>& Positions = Primitive.Positions;
+	TArray<uint32> Indices = Primitive.Indices;
+	const int32 TargetIndices = FMath::Max(FMath::FloorToInt(Indices.Num() / 3 * FMath::Max(TriangleRatio, 0.0f)), 1) * 3;
+
+	TArray<bool> Locked;
+	TArray<int32> PositionGroups;
+	TArray<int32> PositionGroupsSize;
+	glTFRuntimePrimitives::FindLockedVertices(Primitive, Locked, PositionGroups, PositionGroupsSize);
+	const int32 NumGroups = PositionGroupsSize.Num();
+
+	// group -> vertices
+	TArray<int32> GroupsOffsets;
+	GroupsOffsets.AddUninitialized(NumGroups + 1);
+	GroupsOffsets[0] = 0;
+	for (int32 Group = 0; Group < NumGroups; Group++)
+	{
+		GroupsOffsets[Group + 1] = GroupsOffsets[Group] + PositionGroupsSize[Group];
+	}
+	TArray<uint32> GroupsVertices;
+	GroupsVertices.AddUninitialized(NumVertices);
+	TArray<int32> GroupsCursor = GroupsOffsets;
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		GroupsVertices[GroupsCursor[PositionGroups[VertexIndex]]++] = VertexIndex;
+	}
+
+	TArray<glTFRuntimePrimitives::FQuadric> Quadrics;
+	Quadrics.AddDefaulted(NumVertices);
+	for (int32 Index = 0; Index < Indices.Num(); Index += 3)
+	{
+		const FVector& Position0 = Positions[Indices[Index]];
+		const FVector Cross = FVector::CrossProduct(Positions[Indices[Index + 1]] - Position0, Positions[Indices[Index + 2]] - Position0);
+		const double Area = Cross.Size() * 0.5;
+		if (Area <= 0)
+		{
+			continue;
+		}
+		const FVector Normal = Cross.GetSafeNormal();
+		const double Distance = -FVector::DotProduct(Normal, Position0);
+		for (int32 Corner = 0; Corner < 3; Corner++)
+		{
+			Quadrics[Indices[Index + Corner]].AddPlane(Normal, Distance, Area);
+		}
+	}
+
+	struct FCollapse
+	{
+		uint32 From;
+		uint32 To;
+		double Cost;
+	};
+
+	struct FCollapsePair
+	{
+		uint32 From;
+		uint32 To;
+	};
+
+	TArray<FCollapse> Collapses;
+	TArray<FCollapsePair> CollapsePairs;
+	TArray<int32> AdjacencyOffsets;
+	TArray<int32> Adjacency;
+	TArray<uint32> Remap;
+	TArray<bool> Touched;
+	TArray<glTFRuntimePrimitives::FQuadric> GroupsQuadrics;
+
+	// each pass collapses the cheapest independent edges, then the index buffer is rebuilt
+	while (Indices.Num() > TargetIndices)
+	{
+		const int32 NumTriangles = Indices.Num() / 3;
+
+		AdjacencyOffsets.Init(0, NumVertices + 1);
+		for (const uint32 VertexIndex : Indices)
+		{
+			AdjacencyOffsets[VertexIndex + 1]++;
+		}
+		for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+		{
+			AdjacencyOffsets[VertexIndex + 1] += AdjacencyOffsets[VertexIndex];
+		}
+		Adjacency.SetNumUninitialized(Indices.Num());
+		TArray<int32> AdjacencyCursor = AdjacencyOffsets;
+		for (int32 Index = 0; Index < Indices.Num(); Index++)
+		{
+			Adjacency[AdjacencyCursor[Indices[Index]]++] = Index / 3;
+		}
+
+		// the error of moving a seam is the error of all of its copies
+		GroupsQuadrics.Init(glTFRuntimePrimitives::FQuadric(), NumGroups);
+		for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+		{
+			if (AdjacencyOffsets[VertexIndex + 1] > AdjacencyOffsets[VertexIndex])
+			{
+				GroupsQuadrics[PositionGroups[VertexIndex]].Add(Quadrics[VertexIndex]);
+			}
+		}
+
+		Collapses.Reset();
+		for (int32 Index = 0; Index < Indices.Num(); Index++)
+		{
+			const uint32 VertexA = Indices[Index];
+			const uint32 VertexB = Indices[(Index % 3) == 2 ? Index - 2 : Index + 1];
+			if (PositionGroups[VertexA] == PositionGroups[VertexB])
+			{
+				continue;
+			}
+			if (!Locked[VertexA])
+			{
+				Collapses.Add({ VertexA, VertexB, GroupsQuadrics[PositionGroups[VertexA]].Error(Positions[VertexB]) });
+			}
+			if (!Locked[VertexB])
+			{
+				Collapses.Add({ VertexB, VertexA, GroupsQuadrics[PositionGroups[VertexB]].Error(Positions[VertexA]) });
+			}
+		}
+
+		Algo::SortBy(Collapses, &FCollapse::Cost);
+
+		Remap.SetNumUninitialized(NumVertices);
+		for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+		{
+			Remap[VertexIndex] = VertexIndex;
+		}
+		Touched.Init(false, NumVertices);
+
+		const int32 TrianglesToRemove = (Indices.Num() - TargetIndices) / 3;
+		int32 RemovedTriangles = 0;
+		for (const FCollapse& Collapse : Collapses)
+		{
+			if (RemovedTriangles >= TrianglesToRemove)
+			{
+				break;
+			}
+
+			// every copy of the position moves along an edge of its own side of the seam, crossing the seam is not allowed
+			const int32 GroupFrom = PositionGroups[Collapse.From];
+			const int32 GroupTo = PositionGroups[Collapse.To];
+			bool bValid = true;
+			CollapsePairs.Reset();
+			for (int32 GroupIndex = GroupsOffsets[GroupFrom]; bValid && GroupIndex < GroupsOffsets[GroupFrom + 1]; GroupIndex++)
+			{
+				const uint32 From = GroupsVertices[GroupIndex];
+				// not referenced anymore
+				if (AdjacencyOffsets[From] == AdjacencyOffsets[From + 1])
+				{
+					continue;
+				}
+
+				uint32 To = From;
+				for (int32 AdjacencyIndex = AdjacencyOffsets[From]; To == From && AdjacencyIndex < AdjacencyOffsets[From + 1]; AdjacencyIndex++)
+				{
+					const int32 TriangleIndex = Adjacency[AdjacencyIndex];
+					for (int32 Corner = 0; Corner < 3; Corner++)
+					{
+						if (PositionGroups[Indices[TriangleIndex * 3 + Corner]] == GroupTo)
+						{
+							To = Indices[TriangleIndex * 3 + Corner];
+							break;
+						}
+					}
+				}
+
+				bValid = To != From && !Touched[From] && !Touched[To];
+				CollapsePairs.Add({ From, To });
+			}
+
+			if (!bValid)
+			{
+				continue;
+			}
+
+			// reject collapses flipping the surrounding triangles
+			bool bFlips = false;
+			int32 CollapsedTriangles = 0;
+			for (const FCollapsePair& CollapsePair : CollapsePairs)
+			{
+				for (int32 AdjacencyIndex = AdjacencyOffsets[CollapsePair.From]; !bFlips && AdjacencyIndex < AdjacencyOffsets[CollapsePair.From + 1]; AdjacencyIndex++)
+				{
+					const int32 TriangleIndex = Adjacency[AdjacencyIndex];
+					const uint32 Vertex0 = Indices[TriangleIndex * 3];
+					const uint32 Vertex1 = Indices[TriangleIndex * 3 + 1];
+					const uint32 Vertex2 = Indices[TriangleIndex * 3 + 2];
+					if (Vertex0 == CollapsePair.To || Vertex1 == CollapsePair.To || Vertex2 == CollapsePair.To)
+					{
+						CollapsedTriangles++;
+						continue;
+					}
+
+					const FVector Position0 = Positions[Vertex0];
+					const FVector Position1 = Positions[Vertex1];
+					const FVector Position2 = Positions[Vertex2];
+					const FVector NewPosition0 = Vertex0 == CollapsePair.From ? Positions[CollapsePair.To] : Position0;
+					const FVector NewPosition1 = Vertex1 == CollapsePair.From ? Positions[CollapsePair.To] : Position1;
+					const FVector NewPosition2 = Vertex2 == CollapsePair.From ? Positions[CollapsePair.To] : Position2;
+
+					const FVector Normal = FVector::CrossProduct(Position1 - Position0, Position2 - Position0);
+					const FVector NewNormal = FVector::CrossProduct(NewPosition1 - NewPosition0, NewPosition2 - NewPosition0);
+					if (FVector::DotProduct(Normal, NewNormal) <= 0)
+					{
+						bFlips = true;
+					}
+				}
+			}
+
+			if (bFlips)
+			{
+				continue;
+			}
+
+			RemovedTriangles += CollapsedTriangles;
+			for (const FCollapsePair& CollapsePair : CollapsePairs)
+			{
+				Remap[CollapsePair.From] = CollapsePair.To;
+				Quadrics[CollapsePair.To].Add(Quadrics[CollapsePair.From]);
+
+				// the whole neighbourhood is frozen until the next pass
+				for (int32 AdjacencyIndex = AdjacencyOffsets[CollapsePair.From]; AdjacencyIndex < AdjacencyOffsets[CollapsePair.From + 1]; AdjacencyIndex++)
+				{
+					const int32 TriangleIndex = Adjacency[AdjacencyIndex];
+					Touched[Indices[TriangleIndex * 3]] = true;
+					Touched[Indices[TriangleIndex * 3 + 1]] = true;
+					Touched[Indices[TriangleIndex * 3 + 2]] = true;
+				}
+			}
+		}
+
+		if (RemovedTriangles == 0)
+		{
+			break;
+		}
+
+		TArray<uint32> NewIndices;
+		NewIndices.Reserve(Indices.Num());
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+		{
+			const uint32 Vertex0 = Remap[Indices[TriangleIndex * 3]];
+			const uint32 Vertex1 = Remap[Indices[TriangleIndex * 3 + 1]];
+			const uint32 Vertex2 = Remap[Indices[TriangleIndex * 3 + 2]];
+			if (Vertex0 != Vertex1 && Vertex1 != Vertex2 && Vertex0 != Vertex2)
+			{
+				NewIndices.Add(Vertex0);
+				NewIndices.Add(Vertex1);
+				NewIndices.Add(Vertex2);
+			}
+		}
+		Indices = MoveTemp(NewIndices);
+	}
+
+	// drop the vertices not referenced anymore
+	TArray<int32> VerticesRemap;
+	VerticesRemap.Init(INDEX_NONE, NumVertices);
+	TArray<int32> NewVertices;
+	for (uint32& VertexIndex : Indices)
+	{
+		if (VerticesRemap[VertexIndex] == INDEX_NONE)
+		{
+			VerticesRemap[VertexIndex] = NewVertices.Add(VertexIndex);
+		}
+		VertexIndex = VerticesRemap[VertexIndex];
+	}
+
+	glTFRuntimePrimitives::RemapVertices(SimplifiedPrimitive, NewVertices);
+	SimplifiedPrimitive.Indices = MoveTemp(Indices);
+	SimplifiedPrimitive.bHasSynthesizedIndices = false;
+
+	UE_LOG(LogGLTFRuntime, Verbose, TEXT("Simplified primitive triangles: %d -> %d"), Primitive.Indices.Num() / 3, SimplifiedPrimitive.Indices.Num() / 3);
+
+	// borders and non-manifold edges are locked, a mesh made mostly of them cannot reach the requested ratio
+	if (SimplifiedPrimitive.Indices.Num() > TargetIndices * 2)
+	{
+		UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to simplify primitive to %f of its triangles: %d -> %d"), TriangleRatio, Primitive.Indices.Num() / 3, SimplifiedPrimitive.Indices.Num() / 3);
+	}
+
+	return true;
+}
+
+bool FglTFRuntimeParser::GenerateSmoothNormals(FglTFRuntimePrimitive& Primitive, const float CreaseAngle, const bool bReverseWinding)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_GenerateSmoothNormals, FColor::Magenta);
+
+	const int32 NumVertices = Primitive.Positions.Num();
+	const int32 NumCorners = Primitive.Indices.Num();
+	if (NumVertices == 0 || NumCorners == 0 || (NumCorners % 3) != 0)
+	{
+		return false;
+	}
+
+	for (const uint32 VertexIndex : Primitive.Indices)
+	{
+		if (VertexIndex >= static_cast<uint32>(NumVertices))
+		{
+			return false;
+		}
+	}
+
+	// the old normals (if any) are going to be replaced
+	TArray<FVector> OldNormals = MoveTemp(Primitive.Normals);
+	if (!glTFRuntimePrimitives::CanRemapVertices(Primitive))
+	{
+		Primitive.Normals = MoveTemp(OldNormals);
+		return false;
+	}
+
+	const TArray<uint32>& Indices = Primitive.Indices;
+	const int32 NumTriangles = NumCorners / 3;
+
+	// unit face normals (same orientation of the flat ones) and the angle of each corner as its weight
+	TArray<FVector> FaceNormals;
+	FaceNormals.AddUninitialized(NumTriangles);
+	TArray<float> CornerWeights;
+	CornerWeights.AddUninitialized(NumCorners);
+	ParallelFor(NumTriangles, [&](const int32 TriangleIndex)
+		{
+			const FVector& Position0 = Primitive.Positions[Indices[TriangleIndex * 3]];
+			const FVector& Position1 = Primitive.Positions[Indices[TriangleIndex * 3 + 1]];
+			const FVector& Position2 = Primitive.Positions[Indices[TriangleIndex * 3 + 2]];
+			const FVector FaceNormal = FVector::CrossProduct(Position2 - Position0, Position1 - Position0).GetSafeNormal();
+			FaceNormals[TriangleIndex] = bReverseWinding ? -FaceNormal : FaceNormal;
+
+			const FVector Corners[3] = { Position0, Position1, Position2 };
+			for (int32 Corner = 0; Corner < 3; Corner++)
+			{
+				const FVector EdgeA = (Corners[(Corner + 1) % 3] - Corners[Corner]).GetSafeNormal();
+				const FVector EdgeB = (Corners[(Corner + 2) % 3] - Corners[Corner]).GetSafeNormal();
+				CornerWeights[TriangleIndex * 3 + Corner] = FMath::Acos(FMath::Clamp<float>(FVector::DotProduct(EdgeA, EdgeB), -1, 1));
+			}
+		});
+
+	// vertices split by seams (uvs, colors...) still share the same position, so adjacency is by position
+	TMap<FVector, int32> PositionsMap;
+	PositionsMap.Reserve(NumVertices);
+	TArray<int32> VertexPositions;
+	VertexPositions.AddUninitialized(NumVertices);
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		VertexPositions[VertexIndex] = PositionsMap.FindOrAdd(Primitive.Positions[VertexIndex], PositionsMap.Num());
+	}
+
+	const int32 NumPositions = PositionsMap.Num();
+	TArray<int32> PositionCornersOffsets;
+	PositionCornersOffsets.AddZeroed(NumPositions + 1);
+	for (const uint32 VertexIndex : Indices)
+	{
+		PositionCornersOffsets[VertexPositions[VertexIndex] + 1]++;
+	}
+	for (int32 PositionIndex = 0; PositionIndex < NumPositions; PositionIndex++)
+	{
+		PositionCornersOffsets[PositionIndex + 1] += PositionCornersOffsets[PositionIndex];
+	}
+
+	TArray<int32> PositionCorners;
+	PositionCorners.AddUninitialized(NumCorners);
+	{
+		TArray<int32> PositionCornersCursors = PositionCornersOffsets;
+		for (int32 CornerIndex = 0; CornerIndex < NumCorners; CornerIndex++)
+		{
+			PositionCorners[PositionCornersCursors[VertexPositions[Indices[CornerIndex]]]++] = CornerIndex;
+		}
+	}
+
+	// each corner averages the faces around its position that are within the crease angle from its own face
+	const bool bUseCreaseAngle = CreaseAngle < 180;
+	const float CosCreaseAngle = FMath::Cos(FMath::DegreesToRadians(FMath::Max(CreaseAngle, 0.0f)));
+	TArray<FVector> CornerNormals;
+	CornerNormals.AddUninitialized(NumCorners);
+	ParallelFor(NumPositions, [&](const int32 PositionIndex)
+		{
+			const int32 First = PositionCornersOffsets[PositionIndex];
+			const int32 Last = PositionCornersOffsets[PositionIndex + 1];
+
+			if (!bUseCreaseAngle)
+			{
+				FVector Normal = FVector::ZeroVector;
+				for (int32 Index = First; Index < Last; Index++)
+				{
+					Normal += FaceNormals[PositionCorners[Index] / 3] * CornerWeights[PositionCorners[Index]];
+				}
+				Normal.Normalize();
+				for (int32 Index = First; Index < Last; Index++)
+				{
+					CornerNormals[PositionCorners[Index]] = Normal.IsZero() ? FaceNormals[PositionCorners[Index] / 3] : Normal;
+				}
+				return;
+			}
+
+			for (int32 Index = First; Index < Last; Index++)
+			{
+				const FVector& FaceNormal = FaceNormals[PositionCorners[Index] / 3];
+				FVector Normal = FVector::ZeroVector;
+				for (int32 OtherIndex = First; OtherIndex < Last; OtherIndex++)
+				{
+					const FVector& OtherFaceNormal = FaceNormals[PositionCorners[OtherIndex] / 3];
+					if (FVector::DotProduct(FaceNormal, OtherFaceNormal) >= CosCreaseAngle)
+					{
+						Normal += OtherFaceNormal * CornerWeights[PositionCorners[OtherIndex]];
+					}
+				}
+				Normal.Normalize();
+				CornerNormals[PositionCorners[Index]] = Normal.IsZero() ? FaceNormal : Normal;
+			}
+		});
+
+	// a vertex used by corners with different normals (a crease) is duplicated, everything else stays shared
+	TArray<int32> NewVertices;
+	NewVertices.AddUninitialized(NumVertices);
+	TArray<FVector> Normals;
+	Normals.AddUninitialized(NumVertices);
+	TArray<int32> NextSplit;
+	NextSplit.Init(INDEX_NONE, NumVertices);
+	TArray<bool> Used;
+	Used.AddZeroed(NumVertices);
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		NewVertices[VertexIndex] = VertexIndex;
+		Normals[VertexIndex] = FVector::UpVector;
+	}
+
+	TArray<uint32> NewIndices;
+	NewIndices.AddUninitialized(NumCorners);
+	for (int32 CornerIndex = 0; CornerIndex < NumCorners; CornerIndex++)
+	{
+		const int32 VertexIndex = Indices[CornerIndex];
+		const FVector& CornerNormal = CornerNormals[CornerIndex];
+
+		if (!Used[VertexIndex])
+		{
+			Used[VertexIndex] = true;
+			Normals[VertexIndex] = CornerNormal;
+			NewIndices[CornerIndex] = VertexIndex;
+			continue;
+		}
+
+		int32 SplitIndex = VertexIndex;
+		int32 LastSplitIndex = VertexIndex;
+		while (SplitIndex != INDEX_NONE && !Normals[SplitIndex].Equals(CornerNormal, KINDA_SMALL_NUMBER))
+		{
+			LastSplitIndex = SplitIndex;
+			SplitIndex = NextSplit[SplitIndex];
+		}
+
+		if (SplitIndex == INDEX_NONE)
+		{
+			SplitIndex = NewVertices.Add(VertexIndex);
+			Normals.Add(CornerNormal);
+			NextSplit.Add(INDEX_NONE);
+			NextSplit[LastSplitIndex] = SplitIndex;
+		}
+
+		NewIndices[CornerIndex] = SplitIndex;
+	}
+
+	if (NewVertices.Num() > NumVertices)
+	{
+		glTFRuntimePrimitives::RemapVertices(Primitive, NewVertices);
+	}
+
+	Primitive.Normals = MoveTemp(Normals);
+	Primitive.Indices = MoveTemp(NewIndices);
+	Primitive.bHasSynthesizedIndices = false;
+
+	UE_LOG(LogGLTFRuntime, Verbose, TEXT("Generated smooth normals: %d vertices (%d split by creases)"), Primitive.Positions.Num(), Primitive.Positions.Num() - NumVertices);
+
+	return true;
+}
+
+bool FglTFRuntimeParser::GenerateTangents(FglTFRuntimePrimitive& Primitive, const bool bOrthogonalOnly)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_GenerateTangents, FColor::Magenta);
+
+	const int32 NumVertices = Primitive.Positions.Num();
+	const int32 NumCorners = Primitive.Indices.Num();
+	if (NumVertices == 0 || Primitive.Normals.Num() != NumVertices)
+	{
+		return false;
+	}
+
+	// any tangent orthogonal to the normal, for materials without a normal map
+	if (bOrthogonalOnly)
+	{
+		Primitive.Tangents.SetNumUninitialized(NumVertices);
+		ParallelFor(NumVertices, [&](const int32 VertexIndex)
+			{
+				const FVector& Normal = Primitive.Normals[VertexIndex];
+				FVector Tangent = FVector::CrossProduct(FMath::Abs(Normal.Z) < 0.999f ? FVector::UpVector : FVector::ForwardVector, Normal).GetSafeNormal();
+				Primitive.Tangents[VertexIndex] = FVector4(Tangent.IsZero() ? FVector::ForwardVector : Tangent, 1);
+			});
+		return true;
+	}
+
+	if (NumCorners == 0 || (NumCorners % 3) != 0 || Primitive.UVs.Num() == 0 || Primitive.UVs[0].Num() != NumVertices)
+	{
+		return false;
+	}
+
+	for (const uint32 VertexIndex : Primitive.Indices)
+	{
+		if (VertexIndex >= static_cast<uint32>(NumVertices))
+		{
+			return false;
+		}
+	}
+
+	// the old tangents (if any) are going to be replaced
+	TArray<FVector4> OldTangents = MoveTemp(Primitive.Tangents);
+	if (!glTFRuntimePrimitives::CanRemapVertices(Primitive))
+	{
+		Primitive.Tangents = MoveTemp(OldTangents);
+		return false;
+	}
+
+	const TArray<uint32>& Indices = Primitive.Indices;
+	const TArray<FVector2D>& UVs = Primitive.UVs[0];
+	const int32 NumTriangles = NumCorners / 3;
+
+	// MikkTSpace style corners: the triangle uv derivatives projected on the vertex normal, weighted by the corner angle.
+	// The orientation (tangent frame handedness) of each corner decides which copy of the vertex it contributes to.
+	TArray<FVector> CornerTangents;
+	CornerTangents.AddUninitialized(NumCorners);
+	TArray<FVector> CornerBitangents;
+	CornerBitangents.AddUninitialized(NumCorners);
+	TArray<uint8> CornerOrientations;
+	CornerOrientations.AddUninitialized(NumCorners);
+	ParallelFor(NumTriangles, [&](const int32 TriangleIndex)
+		{
+			const uint32 TriangleIndices[3] = { Indices[TriangleIndex * 3], Indices[TriangleIndex * 3 + 1], Indices[TriangleIndex * 3 + 2] };
+			const FVector& Position0 = Primitive.Positions[TriangleIndices[0]];
+			const FVector& Position1 = Primitive.Positions[TriangleIndices[1]];
+			const FVector& Position2 = Primitive.Positions[TriangleIndices[2]];
+
+			const FVector DeltaPosition0 = Position1 - Position0;
+			const FVector DeltaPosition1 = Position2 - Position0;
+			const FVector2D DeltaUV0 = UVs[TriangleIndices[1]] - UVs[TriangleIndices[0]];
+			const FVector2D DeltaUV1 = UVs[TriangleIndices[2]] - UVs[TriangleIndices[0]];
+
+			const float SignedAreaUV = DeltaUV0.X * DeltaUV1.Y - DeltaUV0.Y * DeltaUV1.X;
+			const bool bDegenerate = FMath::IsNearlyZero(SignedAreaUV, SMALL_NUMBER);
+
+			// only the directions matter, so the area normalization can be skipped
+			const FVector TriangleTangent = (DeltaPosition0 * DeltaUV1.Y) - (DeltaPosition1 * DeltaUV0.Y);
+			const FVector TriangleBitangent = (DeltaPosition1 * DeltaUV0.X) - (DeltaPosition0 * DeltaUV1.X);
+			const float Sign = SignedAreaUV < 0 ? -1.0f : 1.0f;
+
+			const FVector Corners[3] = { Position0, Position1, Position2 };
+			for (int32 Corner = 0; Corner < 3; Corner++)
+			{
+				const int32 CornerIndex = TriangleIndex * 3 + Corner;
+				const FVector& Normal = Primitive.Normals[TriangleIndices[Corner]];
+
+				if (bDegenerate)
+				{
+					CornerTangents[CornerIndex] = FVector::ZeroVector;
+					CornerBitangents[CornerIndex] = FVector::ZeroVector;
+					CornerOrientations[CornerIndex] = 0xFF;
+					continue;
+				}
+
+				const FVector Tangent = ((TriangleTangent - Normal * FVector::DotProduct(Normal, TriangleTangent)) * Sign).GetSafeNormal();
+				const FVector Bitangent = ((TriangleBitangent - Normal * FVector::DotProduct(Normal, TriangleBitangent)) * Sign).GetSafeNormal();
+
+				const FVector EdgeA = (Corners[(Corner + 1) % 3] - Corners[Corner]).GetSafeNormal();
+				const FVector EdgeB = (Corners[(Corner + 2) % 3] - Corners[Corner]).GetSafeNormal();
+				const float Weight = FMath::Acos(FMath::Clamp<float>(FVector::DotProduct(EdgeA, EdgeB), -1, 1));
+
+				CornerTangents[CornerIndex] = Tangent * Weight;
+				CornerBitangents[CornerIndex] = Bitangent * Weight;
+				CornerOrientations[CornerIndex] = FVector::DotProduct(FVector::CrossProduct(Normal, Tangent), Bitangent) >= 0 ? 1 : 0;
+			}
+		});
+
+	// every vertex can have a copy for each orientation (mirrored uvs), degenerate corners reuse whatever is available
+	TArray<int32> OrientationVertices;
+	OrientationVertices.Init(INDEX_NONE, NumVertices * 2);
+	TArray<int32> NewVertices;
+	NewVertices.Reserve(NumVertices);
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		NewVertices.Add(VertexIndex);
+	}
+	TArray<bool> Used;
+	Used.AddZeroed(NumVertices);
+
+	TArray<uint32> NewIndices;
+	NewIndices.AddUninitialized(NumCorners);
+	for (int32 CornerIndex = 0; CornerIndex < NumCorners; CornerIndex++)
+	{
+		const int32 VertexIndex = Indices[CornerIndex];
+		const uint8 Orientation = CornerOrientations[CornerIndex];
+		if (Orientation == 0xFF)
+		{
+			continue;
+		}
+
+		int32& NewVertexIndex = OrientationVertices[VertexIndex * 2 + Orientation];
+		if (NewVertexIndex == INDEX_NONE)
+		{
+			NewVertexIndex = Used[VertexIndex] ? NewVertices.Add(VertexIndex) : VertexIndex;
+			Used[VertexIndex] = true;
+		}
+		NewIndices[CornerIndex] = NewVertexIndex;
+	}
+
+	for (int32 CornerIndex = 0; CornerIndex < NumCorners; CornerIndex++)
+	{
+		if (CornerOrientations[CornerIndex] == 0xFF)
+		{
+			const int32 VertexIndex = Indices[CornerIndex];
+			const int32 NewVertexIndex = OrientationVertices[VertexIndex * 2 + 1] != INDEX_NONE ? OrientationVertices[VertexIndex * 2 + 1] : OrientationVertices[VertexIndex * 2];
+			NewIndices[CornerIndex] = NewVertexIndex != INDEX_NONE ? NewVertexIndex : VertexIndex;
+		}
+	}
+
+	TArray<FVector> Tangents;
+	Tangents.AddZeroed(NewVertices.Num());
+	TArray<FVector> Bitangents;
+	Bitangents.AddZeroed(NewVertices.Num());
+	for (int32 CornerIndex = 0; CornerIndex < NumCorners; CornerIndex++)
+	{
+		Tangents[NewIndices[CornerIndex]] += CornerTangents[CornerIndex];
+		Bitangents[NewIndices[CornerIndex]] += CornerBitangents[CornerIndex];
+	}
+
+	if (NewVertices.Num() > NumVertices)
+	{
+		glTFRuntimePrimitives::RemapVertices(Primitive, NewVertices);
+	}
+
+	// glTF convention: bitangent = cross(normal, tangent) * w
+	Primitive.Tangents.SetNumUninitialized(NewVertices.Num());
+	ParallelFor(NewVertices.Num(), [&](const int32 VertexIndex)
+		{
+			const FVector& Normal = Primitive.Normals[VertexIndex];
+			FVector Tangent = (Tangents[VertexIndex] - Normal * FVector::DotProduct(Normal, Tangents[VertexIndex])).GetSafeNormal();
+			if (Tangent.IsZero())
+			{
+				Tangent = FVector::CrossProduct(FMath::Abs(Normal.Z) < 0.999f ? FVector::UpVector : FVector::ForwardVector, Normal).GetSafeNormal();
+			}
+			const float W = FVector::DotProduct(FVector::CrossProduct(Normal, Tangent), Bitangents[VertexIndex]) < 0 ? -1.0f : 1.0f;
+			Primitive.Tangents[VertexIndex] = FVector4(Tangent, W);
+		});
+
+	Primitive.Indices = MoveTemp(NewIndices);
+	Primitive.bHasSynthesizedIndices = false;
+
+	UE_LOG(LogGLTFRuntime, Verbose, TEXT("Generated tangents: %d vertices (%d split by mirrored uvs)"), Primitive.Positions.Num(), Primitive.Positions.Num() - NumVertices);
+
+	return true;
+}
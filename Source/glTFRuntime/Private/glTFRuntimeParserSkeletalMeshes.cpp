@@ -21,6 +21,8 @@
 #include "Model.h"
 #include "Animation/MorphTarget.h"
 #include "Async/Async.h"
+#include "glTFRuntimeTaskScheduler.h"
+#include "Async/ParallelFor.h"
 #include "Animation/AnimCurveTypes.h"
 #include "PhysicsEngine/PhysicsAsset.h"
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 25
@@ -40,15 +42,14 @@ struct FglTFRuntimeSkeletalMeshContextFinalizer
 
 	~FglTFRuntimeSkeletalMeshContextFinalizer()
 	{
-		FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([this]()
+		FglTFRuntimeTaskScheduler::RunOnGameThread([this]()
 			{
 				if (SkeletalMeshContext->SkeletalMesh)
 				{
 					SkeletalMeshContext->SkeletalMesh = SkeletalMeshContext->Parser->FinalizeSkeletalMeshWithLODs(SkeletalMeshContext);
 				}
 				AsyncCallback.ExecuteIfBound(SkeletalMeshContext->SkeletalMesh);
-			}, TStatId(), nullptr, ENamedThreads::GameThread);
-		FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
+			});
 	}
 };
 
@@ -175,6 +176,75 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 		SkeletalMeshContext->SkinIndex = SkeletalMeshContext->SkeletalMeshConfig.OverrideSkinIndex;
 	}
 
+	if (SkeletalMeshContext->SkeletalMeshConfig.bWeldVertices)
+	{
+		for (FglTFRuntimeLOD& LOD : SkeletalMeshContext->LODs)
+		{
+			for (FglTFRuntimePrimitive& Primitive : LOD.Primitives)
+			{
+				WeldPrimitive(Primitive, SkeletalMeshContext->SkeletalMeshConfig.WeldPositionEpsilon, SkeletalMeshContext->SkeletalMeshConfig.WeldNormalEpsilon, SkeletalMeshContext->SkeletalMeshConfig.WeldUVEpsilon);
+			}
+		}
+	}
+
+	// additional LODs simplified from LOD0 (vertices never move, so skin weights are preserved)
+	if (SkeletalMeshContext->SkeletalMeshConfig.GeneratedLODs.Num() > 0 && SkeletalMeshContext->LODs.Num() > 0)
+	{
+		const TArray<FglTFRuntimeGeneratedLOD>& GeneratedLODs = SkeletalMeshContext->SkeletalMeshConfig.GeneratedLODs;
+		const int32 NumSourceLODs = SkeletalMeshContext->LODs.Num();
+		const int32 NumPrimitives = SkeletalMeshContext->LODs[0].Primitives.Num();
+		for (int32 GeneratedLODIndex = 0; GeneratedLODIndex < GeneratedLODs.Num(); GeneratedLODIndex++)
+		{
+			FglTFRuntimeLOD& GeneratedLOD = SkeletalMeshContext->LODs.AddDefaulted_GetRef();
+			GeneratedLOD.bHasNormals = SkeletalMeshContext->LODs[0].bHasNormals;
+			GeneratedLOD.bHasTangents = SkeletalMeshContext->LODs[0].bHasTangents;
+			GeneratedLOD.bHasUV = SkeletalMeshContext->LODs[0].bHasUV;
+			GeneratedLOD.Primitives.AddDefaulted(NumPrimitives);
+		}
+
+		ParallelFor(GeneratedLODs.Num() * NumPrimitives, [&](const int32 Index)
+			{
+				const int32 GeneratedLODIndex = Index / NumPrimitives;
+				const int32 PrimitiveIndex = Index % NumPrimitives;
+				SimplifyPrimitive(SkeletalMeshContext->LODs[0].Primitives[PrimitiveIndex], GeneratedLODs[GeneratedLODIndex].TriangleRatio, SkeletalMeshContext->LODs[NumSourceLODs + GeneratedLODIndex].Primitives[PrimitiveIndex]);
+			});
+	}
+
+	const FglTFRuntimeSkeletalMeshConfig& OptimizeConfig = SkeletalMeshContext->SkeletalMeshConfig;
+	const bool bOptimizePrimitives = OptimizeConfig.bOptimizeVertexCache || OptimizeConfig.bOptimizeOverdraw || OptimizeConfig.bOptimizeVertexFetch;
+	if (bOptimizePrimitives || OptimizeConfig.bGenerateSmoothNormals || OptimizeConfig.bGenerateTangents)
+	{
+		TArray<FglTFRuntimePrimitive*> PrimitivesToOptimize;
+		for (FglTFRuntimeLOD& LOD : SkeletalMeshContext->LODs)
+		{
+			for (FglTFRuntimePrimitive& Primitive : LOD.Primitives)
+			{
+				PrimitivesToOptimize.Add(&Primitive);
+			}
+		}
+
+		ParallelFor(PrimitivesToOptimize.Num(), [&](const int32 PrimitiveIndex)
+			{
+				FglTFRuntimePrimitive& Primitive = *PrimitivesToOptimize[PrimitiveIndex];
+				// smooth normals replace the flat ones built from the triangles
+				if (OptimizeConfig.bGenerateSmoothNormals && Primitive.Normals.Num() == 0)
+				{
+					GenerateSmoothNormals(Primitive, OptimizeConfig.NormalsCreaseAngle, false);
+				}
+
+				// done here (in parallel and on the shared vertices) instead of on the final per-triangle vertex buffers
+				if (OptimizeConfig.bGenerateTangents && Primitive.Tangents.Num() == 0)
+				{
+					GenerateTangents(Primitive, OptimizeConfig.bSkipTangentsWithoutNormalMap && !Primitive.bHasNormalTexture);
+				}
+
+				if (bOptimizePrimitives)
+				{
+					OptimizePrimitive(Primitive, OptimizeConfig.bOptimizeVertexCache, OptimizeConfig.bOptimizeOverdraw, OptimizeConfig.OverdrawThreshold, OptimizeConfig.bOptimizeVertexFetch);
+				}
+			});
+	}
+
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 26
 	FReferenceSkeleton& RefSkeleton = SkeletalMeshContext->SkeletalMesh->GetRefSkeleton();
 #else
@@ -566,15 +636,31 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 
 		LodRenderData->RenderSections.SetNumUninitialized(LOD.Primitives.Num());
 
+		// the primitives vertices are shared by their triangles (so welding, generated smooth normals/tangents and the vertex reordering are preserved),
+		// only when the flat normals or per triangle tangents have to be computed here every index gets its own vertex
+		bool bPrimitivesHaveNormals = false;
+		bool bPrimitivesHaveTangents = false;
+		bool bPrimitivesHaveUV = false;
+		for (const FglTFRuntimePrimitive& Primitive : LOD.Primitives)
+		{
+			bPrimitivesHaveNormals |= Primitive.Normals.Num() > 0;
+			bPrimitivesHaveTangents |= Primitive.Tangents.Num() > 0;
+			bPrimitivesHaveUV |= Primitive.UVs.Num() > 0 && Primitive.UVs[0].Num() > 0;
+		}
+		const bool bIndexed = bPrimitivesHaveNormals && (bPrimitivesHaveTangents || !bPrimitivesHaveUV);
+		LOD.bIndexed = bIndexed;
+
 		int32 NumIndices = 0;
+		int32 NumVertices = 0;
 		for (int32 PrimitiveIndex = 0; PrimitiveIndex < LOD.Primitives.Num(); PrimitiveIndex++)
 		{
 			NumIndices += LOD.Primitives[PrimitiveIndex].Indices.Num();
+			NumVertices += bIndexed ? LOD.Primitives[PrimitiveIndex].Positions.Num() : LOD.Primitives[PrimitiveIndex].Indices.Num();
 		}
 
-		LodRenderData->StaticVertexBuffers.PositionVertexBuffer.Init(NumIndices);
+		LodRenderData->StaticVertexBuffers.PositionVertexBuffer.Init(NumVertices);
 		LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.SetUseFullPrecisionUVs(SkeletalMeshContext->SkeletalMeshConfig.bUseHighPrecisionUVs);
-		LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.Init(NumIndices, 1);
+		LodRenderData->StaticVertexBuffers.StaticMeshVertexBuffer.Init(NumVertices, 1);
 
 		int32 NumBones = RefSkeleton.GetNum();
 
@@ -585,7 +671,10 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 		}
 
 		TArray<FSkinWeightInfo> InWeights;
-		InWeights.AddUninitialized(NumIndices);
+		InWeights.AddUninitialized(NumVertices);
+
+		TArray<uint32> LODIndices;
+		LODIndices.Reserve(NumIndices);
 
 		int32 TotalVertexIndex = 0;
 		int32 Base = 0;
@@ -598,21 +687,26 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 			FSkelMeshRenderSection& MeshSection = LodRenderData->RenderSections[PrimitiveIndex];
 
 			MeshSection.MaterialIndex = PrimitiveIndex;
-			MeshSection.BaseIndex = TotalVertexIndex;
+			MeshSection.BaseIndex = LODIndices.Num();
 			MeshSection.NumTriangles = Primitive.Indices.Num() / 3;
 			MeshSection.BaseVertexIndex = Base;
 			MeshSection.MaxBoneInfluences = 4;
 
-			MeshSection.NumVertices = Primitive.Indices.Num();
+			MeshSection.NumVertices = bIndexed ? Primitive.Positions.Num() : Primitive.Indices.Num();
+
+			for (int32 IndexIndex = 0; IndexIndex < Primitive.Indices.Num(); IndexIndex++)
+			{
+				LODIndices.Add(Base + (bIndexed ? Primitive.Indices[IndexIndex] : IndexIndex));
+			}
 
 			Base += MeshSection.NumVertices;
 
 			TMap<int32, TArray<int32>> OverlappingVertices;
 			MeshSection.DuplicatedVerticesBuffer.Init(MeshSection.NumVertices, OverlappingVertices);
 
-			for (int32 VertexIndex = 0; VertexIndex < Primitive.Indices.Num(); VertexIndex++)
+			for (int32 VertexIndex = 0; VertexIndex < MeshSection.NumVertices; VertexIndex++)
 			{
-				int32 Index = Primitive.Indices[VertexIndex];
+				int32 Index = bIndexed ? VertexIndex : Primitive.Indices[VertexIndex];
 				FModelVertex ModelVertex;
 
 #if ENGINE_MAJOR_VERSION > 4
@@ -737,7 +831,7 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 			}
 		}
 
-		if ((!LOD.bHasTangents || !LOD.bHasNormals) && TotalVertexIndex % 3 == 0)
+		if (!bIndexed && (!LOD.bHasTangents || !LOD.bHasNormals) && TotalVertexIndex % 3 == 0)
 		{
 			auto GetTangentY = [](FVector4 Normal, FVector TangentX)
 			{
@@ -894,9 +988,10 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 
 		LodRenderData->SkinWeightVertexBuffer.SetMaxBoneInfluences(4);
 		LodRenderData->SkinWeightVertexBuffer = InWeights;
-		LodRenderData->MultiSizeIndexContainer.CreateIndexBuffer(sizeof(uint32_t));
+		LodRenderData->MultiSizeIndexContainer.CreateIndexBuffer(NumVertices <= MAX_uint16 + 1 ? sizeof(uint16) : sizeof(uint32));
+		LodRenderData->MultiSizeIndexContainer.GetIndexBuffer()->Empty(NumIndices);
 
-		for (int32 Index = 0; Index < NumIndices; Index++)
+		for (const uint32 Index : LODIndices)
 		{
 			LodRenderData->MultiSizeIndexContainer.GetIndexBuffer()->AddItem(Index);
 		}
@@ -930,10 +1025,15 @@ USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTF
 		LODInfo.BuildSettings.bUseFullPrecisionUVs = SkeletalMeshContext->SkeletalMeshConfig.bUseHighPrecisionUVs;
 		LODInfo.LODHysteresis = 0.02f;
 
+		const int32 GeneratedLODIndex = LODIndex - (SkeletalMeshContext->LODs.Num() - SkeletalMeshContext->SkeletalMeshConfig.GeneratedLODs.Num());
 		if (SkeletalMeshContext->SkeletalMeshConfig.LODScreenSize.Contains(LODIndex))
 		{
 			LODInfo.ScreenSize = SkeletalMeshContext->SkeletalMeshConfig.LODScreenSize[LODIndex];
 		}
+		else if (GeneratedLODIndex >= 0 && GeneratedLODIndex < SkeletalMeshContext->SkeletalMeshConfig.GeneratedLODs.Num())
+		{
+			LODInfo.ScreenSize = SkeletalMeshContext->SkeletalMeshConfig.GeneratedLODs[GeneratedLODIndex].ScreenSize;
+		}
 
 #if !WITH_EDITOR
 		int32 BaseIndex = 0;
@@ -943,18 +1043,19 @@ USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTF
 		for (int32 PrimitiveIndex = 0; PrimitiveIndex < SkeletalMeshContext->LODs[LODIndex].Primitives.Num(); PrimitiveIndex++)
 		{
 			FglTFRuntimePrimitive& Primitive = SkeletalMeshContext->LODs[LODIndex].Primitives[PrimitiveIndex];
+			const int32 NumPrimitiveVertices = SkeletalMeshContext->LODs[LODIndex].bIndexed ? Primitive.Positions.Num() : Primitive.Indices.Num();
 
 			for (FglTFRuntimeMorphTarget& MorphTargetData : Primitive.MorphTargets)
 			{
 				bool bSkip = true;
 				FMorphTargetLODModel MorphTargetLODModel;
-				MorphTargetLODModel.NumBaseMeshVerts = Primitive.Indices.Num();
+				MorphTargetLODModel.NumBaseMeshVerts = NumPrimitiveVertices;
 				MorphTargetLODModel.SectionIndices.Add(PrimitiveIndex);
 
-				for (int32 Index = 0; Index < Primitive.Indices.Num(); Index++)
+				for (int32 Index = 0; Index < NumPrimitiveVertices; Index++)
 				{
 					FMorphTargetDelta Delta;
-					int32 VertexIndex = Primitive.Indices[Index];
+					int32 VertexIndex = SkeletalMeshContext->LODs[LODIndex].bIndexed ? Index : Primitive.Indices[Index];
 					if (VertexIndex < MorphTargetData.Positions.Num())
 					{
 #if ENGINE_MAJOR_VERSION > 4
@@ -1058,7 +1159,7 @@ USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTF
 
 				MorphTargetIndex++;
 			}
-			BaseIndex += Primitive.Indices.Num();
+			BaseIndex += NumPrimitiveVertices;
 		}
 
 #endif
@@ -1147,6 +1248,7 @@ USkeletalMesh* FglTFRuntimeParser::FinalizeSkeletalMeshWithLODs(TSharedRef<FglTF
 	}
 	else
 	{
+		FScopeLock SkeletonsScopeLock(&SkeletonsCacheLock);
 		if (CanReadFromCache(SkeletalMeshContext->SkeletalMeshConfig.SkeletonConfig.CacheMode) && SkeletonsCache.Contains(SkeletalMeshContext->SkinIndex))
 		{
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 26
@@ -1333,7 +1435,7 @@ void FglTFRuntimeParser::LoadSkeletalMeshAsync(const int32 MeshIndex, const int3
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext = MakeShared<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe>(AsShared(), SkeletalMeshConfig);
 	SkeletalMeshContext->SkinIndex = SkinIndex;
 
-	Async(EAsyncExecution::Thread, [this, SkeletalMeshContext, MeshIndex, AsyncCallback]()
+	FglTFRuntimeTaskScheduler::Dispatch([this, SkeletalMeshContext, MeshIndex, AsyncCallback]()
 		{
 			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback);
 
@@ -1358,7 +1460,7 @@ void FglTFRuntimeParser::LoadSkeletalMeshAsync(const int32 MeshIndex, const int3
 			SkeletalMeshContext->LODs = LODs;
 
 			SkeletalMeshContext->SkeletalMesh = CreateSkeletalMeshFromLODs(SkeletalMeshContext);
-		});
+		}, SkeletalMeshContext->SkeletalMeshConfig.AsyncPriority);
 }
 
 USkeletalMesh* FglTFRuntimeParser::LoadSkeletalMeshLODs(const TArray<int32> MeshIndices, const int32 SkinIndex, const FglTFRuntimeSkeletalMeshConfig & SkeletalMeshConfig)
@@ -1537,7 +1639,7 @@ void FglTFRuntimeParser::LoadSkeletalMeshRecursiveAsync(const FString & NodeName
 {
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext = MakeShared<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe>(AsShared(), SkeletalMeshConfig);
 
-	Async(EAsyncExecution::Thread, [this, SkeletalMeshContext, ExcludeNodes, NodeName, SkinIndex, AsyncCallback]()
+	FglTFRuntimeTaskScheduler::Dispatch([this, SkeletalMeshContext, ExcludeNodes, NodeName, SkinIndex, AsyncCallback]()
 		{
 			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback);
 
@@ -1667,7 +1769,7 @@ void FglTFRuntimeParser::LoadSkeletalMeshRecursiveAsync(const FString & NodeName
 			SkeletalMeshContext->LODs = LODs;
 
 			SkeletalMeshContext->SkeletalMesh = CreateSkeletalMeshFromLODs(SkeletalMeshContext);
-		});
+		}, SkeletalMeshContext->SkeletalMeshConfig.AsyncPriority);
 }
 
 UAnimSequence* FglTFRuntimeParser::LoadSkeletalAnimationByName(USkeletalMesh * SkeletalMesh, const FString AnimationName, const FglTFRuntimeSkeletalAnimationConfig & SkeletalAnimationConfig)
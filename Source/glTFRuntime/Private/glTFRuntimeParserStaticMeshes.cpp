@@ -2,6 +2,8 @@
 
 #include "glTFRuntimeParser.h"
 #include "Async/Async.h"
+#include "glTFRuntimeTaskScheduler.h"
+#include "Async/ParallelFor.h"
 #include "StaticMeshOperations.h"
 #include "Engine/StaticMeshSocket.h"
 #if WITH_EDITOR
@@ -54,7 +56,7 @@ void FglTFRuntimeParser::LoadStaticMeshAsync(const int32 MeshIndex, FglTFRuntime
 
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), StaticMeshConfig);
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, MeshIndex, AsyncCallback]()
+	FglTFRuntimeTaskScheduler::Dispatch([this, StaticMeshContext, MeshIndex, AsyncCallback]()
 		{
 
 			TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
@@ -68,7 +70,7 @@ void FglTFRuntimeParser::LoadStaticMeshAsync(const int32 MeshIndex, FglTFRuntime
 				StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext, JsonMeshObjects, PrimitivesCache);
 			}
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([MeshIndex, StaticMeshContext, AsyncCallback]()
+			FglTFRuntimeTaskScheduler::RunOnGameThread([MeshIndex, StaticMeshContext, AsyncCallback]()
 				{
 					if (StaticMeshContext->StaticMesh)
 					{
@@ -84,9 +86,8 @@ void FglTFRuntimeParser::LoadStaticMeshAsync(const int32 MeshIndex, FglTFRuntime
 					}
 
 					AsyncCallback.ExecuteIfBound(StaticMeshContext->StaticMesh);
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		});
+				});
+		}, StaticMeshContext->StaticMeshConfig.AsyncPriority);
 }
 
 UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext, TArray<TSharedRef<FJsonObject>> JsonMeshObjects, const TMap<TSharedRef<FJsonObject>, TArray<FglTFRuntimePrimitive>>& PrimitivesCache)
@@ -97,95 +98,219 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 	FStaticMeshRenderData* RenderData = StaticMeshContext->RenderData;
 	const FglTFRuntimeStaticMeshConfig& StaticMeshConfig = StaticMeshContext->StaticMeshConfig;
 
-	bool bHasVertexColors = false;
-
-	RenderData->AllocateLODResources(JsonMeshObjects.Num());
+	struct FglTFRuntimeStaticMeshLODBuild
+	{
+		TArray<FglTFRuntimePrimitive> Primitives;
+		TArray<FStaticMeshBuildVertex> StaticMeshBuildVertices;
+		TArray<uint32> LODIndices;
+		int32 NumUVs = 1;
+		bool bHasVertexColors = false;
+		FBox BoundingBox = FBox(ForceInit);
+	};
 
-	int32 LODIndex = 0;
+	struct FglTFRuntimeStaticMeshSectionBuild
+	{
+		int32 LODIndex;
+		int32 PrimitiveIndex;
+		int32 FirstIndex;
+		int32 BaseVertexIndex;
+		int32 NumVertices;
+		bool bIndexed;
+		bool bCanGenerateNormals;
+		bool bHasGeneratedTangents = false;
+		FBox BoundingBox = FBox(ForceInit);
+	};
+
+	TArray<FglTFRuntimeStaticMeshLODBuild> LODBuilds;
+	LODBuilds.AddDefaulted(JsonMeshObjects.Num());
+	TArray<FglTFRuntimeStaticMeshSectionBuild> SectionBuilds;
 
 	const float TangentsDirection = StaticMeshConfig.bReverseTangents ? 1 : -1;
 
-	for (TSharedRef<FJsonObject> JsonMeshObject : JsonMeshObjects)
+	bool bHasVertexColors = false;
+	auto AddSectionBuilds = [&](const int32 LODIndex)
 	{
-		const int32 CurrentLODIndex = LODIndex++;
-		FStaticMeshLODResources& LODResources = RenderData->LODResources[CurrentLODIndex];
+		FglTFRuntimeStaticMeshLODBuild& LODBuild = LODBuilds[LODIndex];
+		for (int32 PrimitiveIndex = 0; PrimitiveIndex < LODBuild.Primitives.Num(); PrimitiveIndex++)
+		{
+			const FglTFRuntimePrimitive& Primitive = LODBuild.Primitives[PrimitiveIndex];
+			if (Primitive.UVs.Num() > LODBuild.NumUVs)
+			{
+				LODBuild.NumUVs = Primitive.UVs.Num();
+			}
 
-#if ENGINE_MAJOR_VERSION > 4
-		FStaticMeshSectionArray& Sections = LODResources.Sections;
-#else
-		FStaticMeshLODResources::FStaticMeshSectionArray& Sections = LODResources.Sections;
-#endif
+			if (Primitive.Colors.Num() > 0)
+			{
+				bHasVertexColors = true;
+			}
 
-		TArray<FglTFRuntimePrimitive> Primitives;
-		TArray<uint32> LODIndices;
+			FglTFRuntimeStaticMeshSectionBuild& SectionBuild = SectionBuilds.AddDefaulted_GetRef();
+			SectionBuild.LODIndex = LODIndex;
+			SectionBuild.PrimitiveIndex = PrimitiveIndex;
+		}
 
+		LODBuild.bHasVertexColors = bHasVertexColors;
+	};
+
+	// primitives loading (materials, json and buffers access) is serial, the heavy geometry work below is not
+	for (int32 LODIndex = 0; LODIndex < JsonMeshObjects.Num(); LODIndex++)
+	{
+		TSharedRef<FJsonObject> JsonMeshObject = JsonMeshObjects[LODIndex];
+		FglTFRuntimeStaticMeshLODBuild& LODBuild = LODBuilds[LODIndex];
 
 		if (PrimitivesCache.Contains(JsonMeshObject))
 		{
-			Primitives = PrimitivesCache[JsonMeshObject];
+			LODBuild.Primitives = PrimitivesCache[JsonMeshObject];
 		}
 		else
 		{
-			if (!LoadPrimitives(JsonMeshObject, Primitives, StaticMeshConfig.MaterialsConfig))
+			if (!LoadPrimitives(JsonMeshObject, LODBuild.Primitives, StaticMeshConfig.MaterialsConfig))
 			{
 				return nullptr;
 			}
 		}
 
-		int32 NumUVs = 1;
-		FVector PivotDelta = FVector::ZeroVector;
+		if (StaticMeshConfig.bWeldVertices)
+		{
+			for (FglTFRuntimePrimitive& Primitive : LODBuild.Primitives)
+			{
+				WeldPrimitive(Primitive, StaticMeshConfig.WeldPositionEpsilon, StaticMeshConfig.WeldNormalEpsilon, StaticMeshConfig.WeldUVEpsilon);
+			}
+		}
 
-		int32 NumVertexInstancesPerLOD = 0;
+		AddSectionBuilds(LODIndex);
+	}
 
-		for (FglTFRuntimePrimitive& Primitive : Primitives)
+	// additional LODs simplified from LOD0
+	StaticMeshContext->NumGeneratedLODs = LODBuilds.Num() > 0 ? FMath::Clamp(StaticMeshConfig.GeneratedLODs.Num(), 0, MAX_STATIC_MESH_LODS - LODBuilds.Num()) : 0;
+	if (StaticMeshContext->NumGeneratedLODs > 0)
+	{
+		const int32 NumSourceLODs = LODBuilds.Num();
+		const int32 NumPrimitives = LODBuilds[0].Primitives.Num();
+		LODBuilds.AddDefaulted(StaticMeshContext->NumGeneratedLODs);
+		for (int32 LODIndex = NumSourceLODs; LODIndex < LODBuilds.Num(); LODIndex++)
 		{
-			if (Primitive.UVs.Num() > NumUVs)
+			LODBuilds[LODIndex].Primitives.AddDefaulted(NumPrimitives);
+		}
+
+		ParallelFor(StaticMeshContext->NumGeneratedLODs * NumPrimitives, [&](const int32 Index)
 			{
-				NumUVs = Primitive.UVs.Num();
+				const int32 GeneratedLODIndex = Index / NumPrimitives;
+				const int32 PrimitiveIndex = Index % NumPrimitives;
+				SimplifyPrimitive(LODBuilds[0].Primitives[PrimitiveIndex], StaticMeshConfig.GeneratedLODs[GeneratedLODIndex].TriangleRatio, LODBuilds[NumSourceLODs + GeneratedLODIndex].Primitives[PrimitiveIndex]);
+			});
+
+		for (int32 LODIndex = NumSourceLODs; LODIndex < LODBuilds.Num(); LODIndex++)
+		{
+			AddSectionBuilds(LODIndex);
+		}
+	}
+
+	RenderData->AllocateLODResources(LODBuilds.Num());
+
+	// vertices are shared (and the glTF indices preserved) unless flat normals have to be generated
+	ParallelFor(SectionBuilds.Num(), [&](const int32 SectionBuildIndex)
+		{
+			FglTFRuntimeStaticMeshSectionBuild& SectionBuild = SectionBuilds[SectionBuildIndex];
+			FglTFRuntimePrimitive& Primitive = LODBuilds[SectionBuild.LODIndex].Primitives[SectionBuild.PrimitiveIndex];
+
+			const bool bMissingNormals = Primitive.Normals.Num() < Primitive.Positions.Num();
+			SectionBuild.bCanGenerateNormals = (bMissingNormals && StaticMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::IfMissing) ||
+				StaticMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Always;
+
+			// smooth normals are generated on the shared vertices, so no need for the flat (unindexed) path
+			if (SectionBuild.bCanGenerateNormals && StaticMeshConfig.bGenerateSmoothNormals)
+			{
+				if (GenerateSmoothNormals(Primitive, StaticMeshConfig.NormalsCreaseAngle, StaticMeshConfig.bReverseWinding))
+				{
+					SectionBuild.bCanGenerateNormals = false;
+				}
 			}
 
-			if (Primitive.Colors.Num() > 0)
+			// with normals on the shared vertices, tangents are generated here too (flat normals still use the per triangle path)
+			const bool bMissingTangents = Primitive.Tangents.Num() < Primitive.Positions.Num();
+			const bool bCanGenerateTangents = (bMissingTangents && StaticMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::IfMissing) ||
+				StaticMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::Always;
+			if (bCanGenerateTangents && !SectionBuild.bCanGenerateNormals)
 			{
-				bHasVertexColors = true;
+				SectionBuild.bHasGeneratedTangents = GenerateTangents(Primitive, StaticMeshConfig.bSkipTangentsWithoutNormalMap && !Primitive.bHasNormalTexture);
 			}
 
-			NumVertexInstancesPerLOD += Primitive.Indices.Num();
-		}
+			if (StaticMeshConfig.bOptimizeVertexCache || StaticMeshConfig.bOptimizeOverdraw || StaticMeshConfig.bOptimizeVertexFetch)
+			{
+				OptimizePrimitive(Primitive, StaticMeshConfig.bOptimizeVertexCache, StaticMeshConfig.bOptimizeOverdraw, StaticMeshConfig.OverdrawThreshold, StaticMeshConfig.bOptimizeVertexFetch);
+			}
 
-		TArray<FStaticMeshBuildVertex> StaticMeshBuildVertices;
-		StaticMeshBuildVertices.SetNum(NumVertexInstancesPerLOD);
+			SectionBuild.bIndexed = !(SectionBuild.bCanGenerateNormals && (Primitive.Indices.Num() % 3) == 0);
+			if (SectionBuild.bIndexed)
+			{
+				for (const uint32 VertexIndex : Primitive.Indices)
+				{
+					if (VertexIndex >= static_cast<uint32>(Primitive.Positions.Num()))
+					{
+						SectionBuild.bIndexed = false;
+						break;
+					}
+				}
+			}
 
-		FBox BoundingBox;
-		BoundingBox.Init();
+			SectionBuild.NumVertices = SectionBuild.bIndexed ? Primitive.Positions.Num() : Primitive.Indices.Num();
+		});
 
-		int32 VertexInstanceBaseIndex = 0;
+	// sections layout (offsets in the LOD buffers and materials slots)
+	for (FglTFRuntimeStaticMeshSectionBuild& SectionBuild : SectionBuilds)
+	{
+		FglTFRuntimeStaticMeshLODBuild& LODBuild = LODBuilds[SectionBuild.LODIndex];
+		const FglTFRuntimePrimitive& Primitive = LODBuild.Primitives[SectionBuild.PrimitiveIndex];
+		FStaticMeshLODResources& LODResources = RenderData->LODResources[SectionBuild.LODIndex];
+
+		FName MaterialName = FName(FString::Printf(TEXT("LOD_%d_Section_%d_%s"), SectionBuild.LODIndex, StaticMeshContext->StaticMaterials.Num(), *Primitive.MaterialName));
+		FStaticMaterial StaticMaterial(Primitive.Material, MaterialName);
+		StaticMaterial.UVChannelData.bInitialized = true;
+		int32 MaterialIndex = StaticMeshContext->StaticMaterials.Add(StaticMaterial);
+
+		SectionBuild.FirstIndex = LODBuild.LODIndices.Num();
+		SectionBuild.BaseVertexIndex = LODBuild.StaticMeshBuildVertices.Num();
+
+		FStaticMeshSection& Section = LODResources.Sections.AddDefaulted_GetRef();
+		Section.NumTriangles = Primitive.Indices.Num() / 3;
+		Section.FirstIndex = SectionBuild.FirstIndex;
+		Section.MinVertexIndex = SectionBuild.BaseVertexIndex;
+		Section.MaxVertexIndex = SectionBuild.BaseVertexIndex + FMath::Max(SectionBuild.NumVertices - 1, 0);
+		Section.bEnableCollision = true;
+		Section.bCastShadow = true;
+		Section.MaterialIndex = MaterialIndex;
+
+		LODBuild.StaticMeshBuildVertices.AddDefaulted(SectionBuild.NumVertices);
+		LODBuild.LODIndices.AddUninitialized(Primitive.Indices.Num());
+	}
 
-		for (FglTFRuntimePrimitive& Primitive : Primitives)
+	ParallelFor(SectionBuilds.Num(), [&](const int32 SectionBuildIndex)
 		{
-			FName MaterialName = FName(FString::Printf(TEXT("LOD_%d_Section_%d_%s"), CurrentLODIndex, StaticMeshContext->StaticMaterials.Num(), *Primitive.MaterialName));
-			FStaticMaterial StaticMaterial(Primitive.Material, MaterialName);
-			StaticMaterial.UVChannelData.bInitialized = true;
-			int32 MaterialIndex = StaticMeshContext->StaticMaterials.Add(StaticMaterial);
-
-			FStaticMeshSection& Section = Sections.AddDefaulted_GetRef();
-			int32 NumVertexInstancesPerSection = Primitive.Indices.Num();
-
-			Section.NumTriangles = NumVertexInstancesPerSection / 3;
-			Section.FirstIndex = VertexInstanceBaseIndex;
-			Section.bEnableCollision = true;
-			Section.bCastShadow = true;
-			Section.MaterialIndex = MaterialIndex;
+			FglTFRuntimeStaticMeshSectionBuild& SectionBuild = SectionBuilds[SectionBuildIndex];
+			FglTFRuntimeStaticMeshLODBuild& LODBuild = LODBuilds[SectionBuild.LODIndex];
+			FglTFRuntimePrimitive& Primitive = LODBuild.Primitives[SectionBuild.PrimitiveIndex];
+			TArray<FStaticMeshBuildVertex>& StaticMeshBuildVertices = LODBuild.StaticMeshBuildVertices;
+			TArray<uint32>& LODIndices = LODBuild.LODIndices;
+
+			const int32 NumIndicesPerSection = Primitive.Indices.Num();
+			const int32 NumVerticesPerSection = SectionBuild.NumVertices;
+			const int32 FirstIndex = SectionBuild.FirstIndex;
+			const int32 BaseVertexIndex = SectionBuild.BaseVertexIndex;
+			const bool bIndexed = SectionBuild.bIndexed;
+			const int32 NumUVs = LODBuild.NumUVs;
+			const bool bHasVertexColors = LODBuild.bHasVertexColors;
+			FBox& BoundingBox = SectionBuild.BoundingBox;
 
 			bool bMissingNormals = false;
 			bool bMissingTangents = false;
 			bool bMissingIgnore = false;
 
-			for (int32 VertexInstanceSectionIndex = 0; VertexInstanceSectionIndex < NumVertexInstancesPerSection; VertexInstanceSectionIndex++)
+			for (int32 SectionVertexIndex = 0; SectionVertexIndex < NumVerticesPerSection; SectionVertexIndex++)
 			{
-				uint32 VertexIndex = Primitive.Indices[VertexInstanceSectionIndex];
-				LODIndices.Add(VertexInstanceBaseIndex + VertexInstanceSectionIndex);
+				uint32 VertexIndex = bIndexed ? SectionVertexIndex : Primitive.Indices[SectionVertexIndex];
 
-				FStaticMeshBuildVertex& StaticMeshVertex = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex];
+				FStaticMeshBuildVertex& StaticMeshVertex = StaticMeshBuildVertices[BaseVertexIndex + SectionVertexIndex];
 
 #if ENGINE_MAJOR_VERSION > 4
 				StaticMeshVertex.Position = FVector3f(GetSafeValue(Primitive.Positions, VertexIndex, FVector::ZeroVector, bMissingIgnore));
@@ -232,27 +357,26 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 				}
 			}
 
-			if (StaticMeshConfig.bReverseWinding && (NumVertexInstancesPerSection % 3) == 0)
+			for (int32 SectionIndex = 0; SectionIndex < NumIndicesPerSection; SectionIndex++)
 			{
-				for (int32 VertexInstanceSectionIndex = 0; VertexInstanceSectionIndex < NumVertexInstancesPerSection; VertexInstanceSectionIndex += 3)
-				{
-					FStaticMeshBuildVertex StaticMeshVertex1 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 1];
-					FStaticMeshBuildVertex StaticMeshVertex2 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 2];
+				LODIndices[FirstIndex + SectionIndex] = BaseVertexIndex + (bIndexed ? Primitive.Indices[SectionIndex] : SectionIndex);
+			}
 
-					StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 1] = StaticMeshVertex2;
-					StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 2] = StaticMeshVertex1;
+			if (StaticMeshConfig.bReverseWinding && (NumIndicesPerSection % 3) == 0)
+			{
+				for (int32 SectionIndex = 0; SectionIndex < NumIndicesPerSection; SectionIndex += 3)
+				{
+					Swap(LODIndices[FirstIndex + SectionIndex + 1], LODIndices[FirstIndex + SectionIndex + 2]);
 				}
 			}
 
-			const bool bCanGenerateNormals = (bMissingNormals && StaticMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::IfMissing) ||
-				StaticMeshConfig.NormalsGenerationStrategy == EglTFRuntimeNormalsGenerationStrategy::Always;
-			if (bCanGenerateNormals && (NumVertexInstancesPerSection % 3) == 0)
+			if (SectionBuild.bCanGenerateNormals && !bIndexed)
 			{
-				for (int32 VertexInstanceSectionIndex = 0; VertexInstanceSectionIndex < NumVertexInstancesPerSection; VertexInstanceSectionIndex += 3)
+				for (int32 SectionIndex = 0; SectionIndex < NumIndicesPerSection; SectionIndex += 3)
 				{
-					FStaticMeshBuildVertex& StaticMeshVertex0 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex];
-					FStaticMeshBuildVertex& StaticMeshVertex1 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 1];
-					FStaticMeshBuildVertex& StaticMeshVertex2 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 2];
+					FStaticMeshBuildVertex& StaticMeshVertex0 = StaticMeshBuildVertices[LODIndices[FirstIndex + SectionIndex]];
+					FStaticMeshBuildVertex& StaticMeshVertex1 = StaticMeshBuildVertices[LODIndices[FirstIndex + SectionIndex + 1]];
+					FStaticMeshBuildVertex& StaticMeshVertex2 = StaticMeshBuildVertices[LODIndices[FirstIndex + SectionIndex + 2]];
 
 #if ENGINE_MAJOR_VERSION > 4
 					FVector SideA = FVector(StaticMeshVertex1.Position - StaticMeshVertex0.Position);
@@ -271,59 +395,40 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 					StaticMeshVertex1.TangentZ = NormalFromCross;
 					StaticMeshVertex2.TangentZ = NormalFromCross;
 #endif
-
-
 				}
 				bMissingNormals = false;
 			}
 
 			const bool bCanGenerateTangents = (bMissingTangents && StaticMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::IfMissing) ||
 				StaticMeshConfig.TangentsGenerationStrategy == EglTFRuntimeTangentsGenerationStrategy::Always;
-			// recompute tangents if required (need normals and uvs)
-			if (bCanGenerateTangents && !bMissingNormals && Primitive.UVs.Num() > 0 && (NumVertexInstancesPerSection % 3) == 0)
+			// recompute tangents if required (need normals and uvs), shared vertices accumulate the tangents of all of their triangles
+			if (bCanGenerateTangents && !SectionBuild.bHasGeneratedTangents && !bMissingNormals && Primitive.UVs.Num() > 0 && (NumIndicesPerSection % 3) == 0)
 			{
-				for (int32 VertexInstanceSectionIndex = 0; VertexInstanceSectionIndex < NumVertexInstancesPerSection; VertexInstanceSectionIndex += 3)
-				{
-					FStaticMeshBuildVertex& StaticMeshVertex0 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex];
-					FStaticMeshBuildVertex& StaticMeshVertex1 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 1];
-					FStaticMeshBuildVertex& StaticMeshVertex2 = StaticMeshBuildVertices[VertexInstanceBaseIndex + VertexInstanceSectionIndex + 2];
-
-
-#if ENGINE_MAJOR_VERSION > 4
-					FVector Position0 = FVector(StaticMeshVertex0.Position);
-					FVector4 TangentZ0 = FVector(StaticMeshVertex0.TangentZ);
-					FVector2D UV0 = FVector2D(StaticMeshVertex0.UVs[0]);
-#else
-					FVector Position0 = StaticMeshVertex0.Position;
-					FVector4 TangentZ0 = StaticMeshVertex0.TangentZ;
-					FVector2D UV0 = StaticMeshVertex0.UVs[0];
-#endif
-
-
-
-#if ENGINE_MAJOR_VERSION > 4
-					FVector Position1 = FVector(StaticMeshVertex1.Position);
-					FVector4 TangentZ1 = FVector(StaticMeshVertex1.TangentZ);
-					FVector2D UV1 = FVector2D(StaticMeshVertex1.UVs[0]);
-#else
-					FVector Position1 = StaticMeshVertex1.Position;
-					FVector4 TangentZ1 = StaticMeshVertex1.TangentZ;
-					FVector2D UV1 = StaticMeshVertex1.UVs[0];
-#endif
-
+				TArray<FVector> TangentsX;
+				TangentsX.AddZeroed(NumVerticesPerSection);
 
+				for (int32 SectionIndex = 0; SectionIndex < NumIndicesPerSection; SectionIndex += 3)
+				{
+					const uint32 VertexIndex0 = LODIndices[FirstIndex + SectionIndex];
+					const uint32 VertexIndex1 = LODIndices[FirstIndex + SectionIndex + 1];
+					const uint32 VertexIndex2 = LODIndices[FirstIndex + SectionIndex + 2];
 
 #if ENGINE_MAJOR_VERSION > 4
-					FVector Position2 = FVector(StaticMeshVertex2.Position);
-					FVector4 TangentZ2 = FVector(StaticMeshVertex2.TangentZ);
-					FVector2D UV2 = FVector2D(StaticMeshVertex2.UVs[0]);
+					FVector Position0 = FVector(StaticMeshBuildVertices[VertexIndex0].Position);
+					FVector2D UV0 = FVector2D(StaticMeshBuildVertices[VertexIndex0].UVs[0]);
+					FVector Position1 = FVector(StaticMeshBuildVertices[VertexIndex1].Position);
+					FVector2D UV1 = FVector2D(StaticMeshBuildVertices[VertexIndex1].UVs[0]);
+					FVector Position2 = FVector(StaticMeshBuildVertices[VertexIndex2].Position);
+					FVector2D UV2 = FVector2D(StaticMeshBuildVertices[VertexIndex2].UVs[0]);
 #else
-					FVector Position2 = StaticMeshVertex2.Position;
-					FVector4 TangentZ2 = StaticMeshVertex2.TangentZ;
-					FVector2D UV2 = StaticMeshVertex2.UVs[0];
+					FVector Position0 = StaticMeshBuildVertices[VertexIndex0].Position;
+					FVector2D UV0 = StaticMeshBuildVertices[VertexIndex0].UVs[0];
+					FVector Position1 = StaticMeshBuildVertices[VertexIndex1].Position;
+					FVector2D UV1 = StaticMeshBuildVertices[VertexIndex1].UVs[0];
+					FVector Position2 = StaticMeshBuildVertices[VertexIndex2].Position;
+					FVector2D UV2 = StaticMeshBuildVertices[VertexIndex2].UVs[0];
 #endif
 
-
 					FVector DeltaPosition0 = Position1 - Position0;
 					FVector DeltaPosition1 = Position2 - Position0;
 
@@ -333,101 +438,136 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 					float Factor = 1.0f / (DeltaUV0.X * DeltaUV1.Y - DeltaUV0.Y * DeltaUV1.X);
 
 					FVector TriangleTangentX = ((DeltaPosition0 * DeltaUV1.Y) - (DeltaPosition1 * DeltaUV0.Y)) * Factor;
-					FVector TriangleTangentY = ((DeltaPosition0 * DeltaUV1.X) - (DeltaPosition1 * DeltaUV0.X)) * Factor;
-
-					FVector TangentX0 = TriangleTangentX - (TangentZ0 * FVector::DotProduct(TangentZ0, TriangleTangentX));
-					TangentX0.Normalize();
-
-					FVector TangentX1 = TriangleTangentX - (TangentZ1 * FVector::DotProduct(TangentZ1, TriangleTangentX));
-					TangentX1.Normalize();
-
-					FVector TangentX2 = TriangleTangentX - (TangentZ2 * FVector::DotProduct(TangentZ2, TriangleTangentX));
-					TangentX2.Normalize();
+					if (!bIndexed || !TriangleTangentX.ContainsNaN())
+					{
+						TangentsX[VertexIndex0 - BaseVertexIndex] += TriangleTangentX;
+						TangentsX[VertexIndex1 - BaseVertexIndex] += TriangleTangentX;
+						TangentsX[VertexIndex2 - BaseVertexIndex] += TriangleTangentX;
+					}
+				}
 
+				for (int32 SectionVertexIndex = 0; SectionVertexIndex < NumVerticesPerSection; SectionVertexIndex++)
+				{
+					FStaticMeshBuildVertex& StaticMeshVertex = StaticMeshBuildVertices[BaseVertexIndex + SectionVertexIndex];
 #if ENGINE_MAJOR_VERSION > 4
-					StaticMeshVertex0.TangentX = FVector3f(TangentX0);
-					StaticMeshVertex0.TangentY = FVector3f(ComputeTangentY(FVector(StaticMeshVertex0.TangentZ), FVector(StaticMeshVertex0.TangentX)) * TangentsDirection);
-
-					StaticMeshVertex1.TangentX = FVector3f(TangentX1);
-					StaticMeshVertex1.TangentY = FVector3f(ComputeTangentY(FVector(StaticMeshVertex1.TangentZ), FVector(StaticMeshVertex1.TangentX)) * TangentsDirection);
-
-					StaticMeshVertex2.TangentX = FVector3f(TangentX2);
-					StaticMeshVertex2.TangentY = FVector3f(ComputeTangentY(FVector(StaticMeshVertex2.TangentZ), FVector(StaticMeshVertex2.TangentX)) * TangentsDirection);
+					FVector TangentZ = FVector(StaticMeshVertex.TangentZ);
 #else
-					StaticMeshVertex0.TangentX = TangentX0;
-					StaticMeshVertex0.TangentY = ComputeTangentY(StaticMeshVertex0.TangentZ, StaticMeshVertex0.TangentX) * TangentsDirection;
-
-					StaticMeshVertex1.TangentX = TangentX1;
-					StaticMeshVertex1.TangentY = ComputeTangentY(StaticMeshVertex1.TangentZ, StaticMeshVertex1.TangentX) * TangentsDirection;
-
-					StaticMeshVertex2.TangentX = TangentX2;
-					StaticMeshVertex2.TangentY = ComputeTangentY(StaticMeshVertex2.TangentZ, StaticMeshVertex2.TangentX) * TangentsDirection;
+					FVector TangentZ = StaticMeshVertex.TangentZ;
 #endif
+					FVector TangentX = TangentsX[SectionVertexIndex] - (TangentZ * FVector::DotProduct(TangentZ, TangentsX[SectionVertexIndex]));
+					TangentX.Normalize();
 
+#if ENGINE_MAJOR_VERSION > 4
+					StaticMeshVertex.TangentX = FVector3f(TangentX);
+					StaticMeshVertex.TangentY = FVector3f(ComputeTangentY(FVector(StaticMeshVertex.TangentZ), FVector(StaticMeshVertex.TangentX)) * TangentsDirection);
+#else
+					StaticMeshVertex.TangentX = TangentX;
+					StaticMeshVertex.TangentY = ComputeTangentY(StaticMeshVertex.TangentZ, StaticMeshVertex.TangentX) * TangentsDirection;
+#endif
 				}
 			}
+		});
 
-			VertexInstanceBaseIndex += NumVertexInstancesPerSection;
-		}
-
-		// check for pivot repositioning
-		if (StaticMeshConfig.PivotPosition != EglTFRuntimePivotPosition::Asset)
+	// merge the sections results and fill the LOD buffers
+	ParallelFor(LODBuilds.Num(), [&](const int32 LODIndex)
 		{
-			if (StaticMeshConfig.PivotPosition == EglTFRuntimePivotPosition::Center)
-			{
-				PivotDelta = BoundingBox.GetCenter();
-			}
-			else if (StaticMeshConfig.PivotPosition == EglTFRuntimePivotPosition::Top)
-			{
-				PivotDelta = BoundingBox.GetCenter() + FVector(0, 0, BoundingBox.GetExtent().Z);
-			}
-			else if (StaticMeshConfig.PivotPosition == EglTFRuntimePivotPosition::Bottom)
+			FglTFRuntimeStaticMeshLODBuild& LODBuild = LODBuilds[LODIndex];
+			TArray<FStaticMeshBuildVertex>& StaticMeshBuildVertices = LODBuild.StaticMeshBuildVertices;
+			FBox& BoundingBox = LODBuild.BoundingBox;
+			for (const FglTFRuntimeStaticMeshSectionBuild& SectionBuild : SectionBuilds)
 			{
-				PivotDelta = BoundingBox.GetCenter() - FVector(0, 0, BoundingBox.GetExtent().Z);
+				if (SectionBuild.LODIndex == LODIndex)
+				{
+					BoundingBox += SectionBuild.BoundingBox;
+				}
 			}
 
-			for (FStaticMeshBuildVertex& StaticMeshVertex : StaticMeshBuildVertices)
+			FVector PivotDelta = FVector::ZeroVector;
+
+			// check for pivot repositioning
+			if (StaticMeshConfig.PivotPosition != EglTFRuntimePivotPosition::Asset)
 			{
+				if (StaticMeshConfig.PivotPosition == EglTFRuntimePivotPosition::Center)
+				{
+					PivotDelta = BoundingBox.GetCenter();
+				}
+				else if (StaticMeshConfig.PivotPosition == EglTFRuntimePivotPosition::Top)
+				{
+					PivotDelta = BoundingBox.GetCenter() + FVector(0, 0, BoundingBox.GetExtent().Z);
+				}
+				else if (StaticMeshConfig.PivotPosition == EglTFRuntimePivotPosition::Bottom)
+				{
+					PivotDelta = BoundingBox.GetCenter() - FVector(0, 0, BoundingBox.GetExtent().Z);
+				}
+
+				for (FStaticMeshBuildVertex& StaticMeshVertex : StaticMeshBuildVertices)
+				{
 #if ENGINE_MAJOR_VERSION > 4
-				StaticMeshVertex.Position -= FVector3f(PivotDelta);
+					StaticMeshVertex.Position -= FVector3f(PivotDelta);
 #else
-				StaticMeshVertex.Position -= PivotDelta;
+					StaticMeshVertex.Position -= PivotDelta;
 #endif
-			}
+				}
 
-			if (CurrentLODIndex == 0)
-			{
-				StaticMeshContext->LOD0PivotDelta = PivotDelta;
+				if (LODIndex == 0)
+				{
+					StaticMeshContext->LOD0PivotDelta = PivotDelta;
+				}
 			}
-		}
 
-		if (CurrentLODIndex == 0)
-		{
-			BoundingBox.GetCenterAndExtents(StaticMeshContext->BoundingBoxAndSphere.Origin, StaticMeshContext->BoundingBoxAndSphere.BoxExtent);
-			StaticMeshContext->BoundingBoxAndSphere.SphereRadius = 0.0f;
-			for (const FStaticMeshBuildVertex& StaticMeshVertex : StaticMeshBuildVertices)
+			if (LODIndex == 0)
 			{
+				BoundingBox.GetCenterAndExtents(StaticMeshContext->BoundingBoxAndSphere.Origin, StaticMeshContext->BoundingBoxAndSphere.BoxExtent);
+				StaticMeshContext->BoundingBoxAndSphere.SphereRadius = 0.0f;
+				for (const FStaticMeshBuildVertex& StaticMeshVertex : StaticMeshBuildVertices)
+				{
 #if ENGINE_MAJOR_VERSION > 4
-				StaticMeshContext->BoundingBoxAndSphere.SphereRadius = FMath::Max((FVector(StaticMeshVertex.Position) - StaticMeshContext->BoundingBoxAndSphere.Origin).Size(), StaticMeshContext->BoundingBoxAndSphere.SphereRadius);
+					StaticMeshContext->BoundingBoxAndSphere.SphereRadius = FMath::Max((FVector(StaticMeshVertex.Position) - StaticMeshContext->BoundingBoxAndSphere.Origin).Size(), StaticMeshContext->BoundingBoxAndSphere.SphereRadius);
 #else
-				StaticMeshContext->BoundingBoxAndSphere.SphereRadius = FMath::Max((StaticMeshVertex.Position - StaticMeshContext->BoundingBoxAndSphere.Origin).Size(), StaticMeshContext->BoundingBoxAndSphere.SphereRadius);
+					StaticMeshContext->BoundingBoxAndSphere.SphereRadius = FMath::Max((StaticMeshVertex.Position - StaticMeshContext->BoundingBoxAndSphere.Origin).Size(), StaticMeshContext->BoundingBoxAndSphere.SphereRadius);
 #endif
+				}
 			}
-		}
 
-		LODResources.VertexBuffers.PositionVertexBuffer.Init(StaticMeshBuildVertices, StaticMesh->bAllowCPUAccess);
-		LODResources.VertexBuffers.StaticMeshVertexBuffer.SetUseFullPrecisionUVs(StaticMeshConfig.bUseHighPrecisionUVs);
-		LODResources.VertexBuffers.StaticMeshVertexBuffer.Init(StaticMeshBuildVertices, NumUVs, StaticMesh->bAllowCPUAccess);
-		if (bHasVertexColors)
+			FStaticMeshLODResources& LODResources = RenderData->LODResources[LODIndex];
+			LODResources.VertexBuffers.PositionVertexBuffer.Init(StaticMeshBuildVertices, StaticMesh->bAllowCPUAccess);
+			LODResources.VertexBuffers.StaticMeshVertexBuffer.SetUseFullPrecisionUVs(StaticMeshConfig.bUseHighPrecisionUVs);
+			LODResources.VertexBuffers.StaticMeshVertexBuffer.Init(StaticMeshBuildVertices, LODBuild.NumUVs, StaticMesh->bAllowCPUAccess);
+			if (LODBuild.bHasVertexColors)
+			{
+				LODResources.VertexBuffers.ColorVertexBuffer.Init(StaticMeshBuildVertices, StaticMesh->bAllowCPUAccess);
+			}
+			LODResources.bHasColorVertexData = LODBuild.bHasVertexColors;
+			if (StaticMesh->bAllowCPUAccess)
+			{
+				LODResources.IndexBuffer = FRawStaticIndexBuffer(true);
+			}
+			LODResources.IndexBuffer.SetIndices(LODBuild.LODIndices, StaticMeshBuildVertices.Num() <= MAX_uint16 + 1 ? EIndexBufferStride::Force16Bit : EIndexBufferStride::Force32Bit);
+		});
+
+	// the hulls budget is for the whole mesh, so all of the LOD0 sections are decomposed together
+	if (StaticMeshConfig.bBuildConvexDecomposition && LODBuilds.Num() > 0)
+	{
+		const FglTFRuntimeStaticMeshLODBuild& LODBuild = LODBuilds[0];
+
+		TArray<FVector> Positions;
+		Positions.AddUninitialized(LODBuild.StaticMeshBuildVertices.Num());
+		for (int32 VertexIndex = 0; VertexIndex < Positions.Num(); VertexIndex++)
 		{
-			LODResources.VertexBuffers.ColorVertexBuffer.Init(StaticMeshBuildVertices, StaticMesh->bAllowCPUAccess);
+			Positions[VertexIndex] = FVector(LODBuild.StaticMeshBuildVertices[VertexIndex].Position);
 		}
-		LODResources.bHasColorVertexData = bHasVertexColors;
-		if (StaticMesh->bAllowCPUAccess)
+
+		TArray<uint32> Indices;
+		for (const FglTFRuntimeStaticMeshSectionBuild& SectionBuild : SectionBuilds)
 		{
-			LODResources.IndexBuffer = FRawStaticIndexBuffer(true);
+			if (SectionBuild.LODIndex == 0)
+			{
+				const int32 NumIndices = LODBuild.Primitives[SectionBuild.PrimitiveIndex].Indices.Num();
+				Indices.Append(LODBuild.LODIndices.GetData() + SectionBuild.FirstIndex, NumIndices - (NumIndices % 3));
+			}
 		}
-		LODResources.IndexBuffer.SetIndices(LODIndices, EIndexBufferStride::Force32Bit);
+
+		DecomposeConvex(Positions, Indices, StaticMeshConfig.ConvexDecompositionMaxHulls, StaticMeshConfig.ConvexDecompositionMaxHullVertices, StaticMeshConfig.ConvexDecompositionMaxConcavity, StaticMeshConfig.ConvexDecompositionSplitPlanes, StaticMeshContext->ConvexHulls);
 	}
 
 	return StaticMesh;
@@ -453,6 +593,16 @@ UStaticMesh* FglTFRuntimeParser::FinalizeStaticMesh(TSharedRef<FglTFRuntimeStati
 	UBodySetup* BodySetup = StaticMesh->BodySetup;
 #endif
 
+	// generated LODs are always the last ones
+	if (RenderData)
+	{
+		const int32 FirstGeneratedLOD = RenderData->LODResources.Num() - StaticMeshContext->NumGeneratedLODs;
+		for (int32 GeneratedLODIndex = 0; GeneratedLODIndex < StaticMeshContext->NumGeneratedLODs; GeneratedLODIndex++)
+		{
+			RenderData->ScreenSize[FirstGeneratedLOD + GeneratedLODIndex].Default = StaticMeshConfig.GeneratedLODs[GeneratedLODIndex].ScreenSize;
+		}
+	}
+
 	// Override LODs ScreenSize
 	for (const TPair<int32, float>& Pair : StaticMeshConfig.LODScreenSize)
 	{
@@ -517,7 +667,37 @@ UStaticMesh* FglTFRuntimeParser::FinalizeStaticMesh(TSharedRef<FglTFRuntimeStati
 		BodySetup->AggGeom.SphereElems.Add(SphereElem);
 	}
 
-	BodySetup->CreatePhysicsMeshes();
+	for (const TArray<FVector>& ConvexHull : StaticMeshContext->ConvexHulls)
+	{
+		FKConvexElem ConvexElem;
+		ConvexElem.VertexData = ConvexHull;
+		ConvexElem.UpdateElemBox();
+		BodySetup->AggGeom.ConvexElems.Add(ConvexElem);
+	}
+
+	if (StaticMeshConfig.bAsyncPhysicsCooking)
+	{
+		TWeakPtr<FglTFRuntimeParser> WeakParser = AsShared();
+		TWeakObjectPtr<UStaticMesh> WeakStaticMesh = StaticMesh;
+		BodySetup->CreatePhysicsMeshesAsync(FOnAsyncPhysicsCookFinished::CreateLambda([WeakParser, WeakStaticMesh](bool bSuccess)
+			{
+				UStaticMesh* CookedStaticMesh = WeakStaticMesh.Get();
+				if (!CookedStaticMesh)
+				{
+					return;
+				}
+
+				TSharedPtr<FglTFRuntimeParser> Parser = WeakParser.Pin();
+				if (Parser && Parser->OnStaticMeshPhysicsCooked.IsBound())
+				{
+					Parser->OnStaticMeshPhysicsCooked.Broadcast(CookedStaticMesh);
+				}
+			}));
+	}
+	else
+	{
+		BodySetup->CreatePhysicsMeshes();
+	}
 
 	for (const TPair<FString, FTransform>& Pair : StaticMeshConfig.Sockets)
 	{
@@ -683,7 +863,7 @@ void FglTFRuntimeParser::LoadStaticMeshLODsAsync(const TArray<int32> MeshIndices
 {
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), StaticMeshConfig);
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, MeshIndices, AsyncCallback]()
+	FglTFRuntimeTaskScheduler::Dispatch([this, StaticMeshContext, MeshIndices, AsyncCallback]()
 		{
 			TArray<TSharedRef<FJsonObject>> JsonMeshObjects;
 			bool bSuccess = true;
@@ -705,7 +885,7 @@ void FglTFRuntimeParser::LoadStaticMeshLODsAsync(const TArray<int32> MeshIndices
 				StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext, JsonMeshObjects, PrimitivesCache);
 			}
 
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMeshContext, AsyncCallback]()
+			FglTFRuntimeTaskScheduler::RunOnGameThread([StaticMeshContext, AsyncCallback]()
 				{
 					if (StaticMeshContext->StaticMesh)
 					{
@@ -713,9 +893,8 @@ void FglTFRuntimeParser::LoadStaticMeshLODsAsync(const TArray<int32> MeshIndices
 					}
 
 					AsyncCallback.ExecuteIfBound(StaticMeshContext->StaticMesh);
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		});
+				});
+		}, StaticMeshContext->StaticMeshConfig.AsyncPriority);
 }
 
 bool FglTFRuntimeParser::LoadStaticMeshIntoProceduralMeshComponent(const int32 MeshIndex, UProceduralMeshComponent* ProceduralMeshComponent, const FglTFRuntimeProceduralMeshConfig& ProceduralMeshConfig)
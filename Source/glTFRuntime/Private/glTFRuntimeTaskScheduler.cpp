@@ -0,0 +1,258 @@
+// Copyright 2020-2022, Roberto De Ioris.
+
+#include "glTFRuntimeTaskScheduler.h"
+#include "glTFRuntimeParser.h"
+#include "Async/Async.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/QueuedThreadPool.h"
+
+DECLARE_STATS_GROUP(TEXT("glTFRuntime"), STATGROUP_glTFRuntime, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Queued Tasks"), STAT_glTFRuntimeQueuedTasks, STATGROUP_glTFRuntime);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Running Tasks"), STAT_glTFRuntimeRunningTasks, STATGROUP_glTFRuntime);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Queued Game Thread Tasks"), STAT_glTFRuntimeQueuedGameThreadTasks, STATGROUP_glTFRuntime);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Last Game Thread Task (ms)"), STAT_glTFRuntimeLastGameThreadTaskTime, STATGROUP_glTFRuntime);
+DECLARE_CYCLE_STAT(TEXT("Game Thread Tasks"), STAT_glTFRuntimeGameThreadTasks, STATGROUP_glTFRuntime);
+
+static TAutoConsoleVariable<int32> CVarglTFRuntimeAsyncMaxThreads(
+	TEXT("glTFRuntime.AsyncMaxThreads"),
+	0,
+	TEXT("Number of workers used by the glTFRuntime async loaders (0 = number of cores minus one). Read when the first async load is started."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarglTFRuntimeGameThreadBudgetMs(
+	TEXT("glTFRuntime.GameThreadBudgetMs"),
+	5.0f,
+	TEXT("Milliseconds per frame spent running queued glTFRuntime game thread tasks (at least one task runs each frame, 0 = no limit)."),
+	ECVF_Default);
+
+namespace glTFRuntimeTaskScheduler
+{
+	FCriticalSection PoolLock;
+	FQueuedThreadPool* Pool = nullptr;
+	FThreadSafeCounter QueuedTasks;
+	FThreadSafeCounter RunningTasks;
+
+	class FQueuedTask : public IQueuedWork
+	{
+	public:
+		FQueuedTask(TUniqueFunction<void()>&& InTask) : Task(MoveTemp(InTask))
+		{
+			QueuedTasks.Increment();
+			INC_DWORD_STAT(STAT_glTFRuntimeQueuedTasks);
+		}
+
+		virtual void DoThreadedWork() override
+		{
+			QueuedTasks.Decrement();
+			DEC_DWORD_STAT(STAT_glTFRuntimeQueuedTasks);
+			RunningTasks.Increment();
+			INC_DWORD_STAT(STAT_glTFRuntimeRunningTasks);
+
+			Task();
+
+			RunningTasks.Decrement();
+			DEC_DWORD_STAT(STAT_glTFRuntimeRunningTasks);
+			delete this;
+		}
+
+		virtual void Abandon() override
+		{
+			QueuedTasks.Decrement();
+			DEC_DWORD_STAT(STAT_glTFRuntimeQueuedTasks);
+			delete this;
+		}
+
+	protected:
+		TUniqueFunction<void()> Task;
+	};
+
+	struct FGameThreadTask
+	{
+		TUniqueFunction<void()> Task;
+		FEvent* CompletedEvent;
+	};
+
+	TQueue<FGameThreadTask*, EQueueMode::Mpsc> GameThreadTasks;
+	FThreadSafeCounter QueuedGameThreadTasks;
+#if ENGINE_MAJOR_VERSION > 4
+	FTSTicker::FDelegateHandle TickerHandle;
+#else
+	FDelegateHandle TickerHandle;
+#endif
+
+	bool RunGameThreadTask()
+	{
+		FGameThreadTask* GameThreadTask = nullptr;
+		if (!GameThreadTasks.Dequeue(GameThreadTask))
+		{
+			return false;
+		}
+
+		QueuedGameThreadTasks.Decrement();
+		DEC_DWORD_STAT(STAT_glTFRuntimeQueuedGameThreadTasks);
+
+		{
+			SCOPE_CYCLE_COUNTER(STAT_glTFRuntimeGameThreadTasks);
+			const double StartTime = FPlatformTime::Seconds();
+			GameThreadTask->Task();
+			SET_FLOAT_STAT(STAT_glTFRuntimeLastGameThreadTaskTime, (FPlatformTime::Seconds() - StartTime) * 1000);
+		}
+
+		// the waiting worker owns the task
+		GameThreadTask->CompletedEvent->Trigger();
+		return true;
+	}
+
+	bool Tick(float DeltaTime)
+	{
+		SCOPED_NAMED_EVENT(FglTFRuntimeTaskScheduler_Tick, FColor::Magenta);
+
+		const double BudgetSeconds = CVarglTFRuntimeGameThreadBudgetMs.GetValueOnGameThread() / 1000.0;
+		const double StartTime = FPlatformTime::Seconds();
+
+		while (RunGameThreadTask())
+		{
+			if (BudgetSeconds > 0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+			{
+				break;
+			}
+		}
+
+		return true;
+	}
+
+	FQueuedThreadPool* GetPool()
+	{
+		FScopeLock Lock(&PoolLock);
+		if (!Pool)
+		{
+			int32 NumThreads = CVarglTFRuntimeAsyncMaxThreads.GetValueOnAnyThread();
+			if (NumThreads <= 0)
+			{
+				NumThreads = FMath::Max(FPlatformMisc::NumberOfCoresIncludingHyperthreads() - 1, 1);
+			}
+
+			Pool = FQueuedThreadPool::Allocate();
+			if (!Pool->Create(NumThreads, 0, TPri_Normal, TEXT("glTFRuntimeThreadPool")))
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to create the glTFRuntime thread pool"));
+				delete Pool;
+				Pool = nullptr;
+			}
+		}
+		return Pool;
+	}
+}
+
+void FglTFRuntimeTaskScheduler::Dispatch(TUniqueFunction<void()>&& Task, const EglTFRuntimeTaskPriority Priority)
+{
+	FQueuedThreadPool* Pool = FPlatformProcess::SupportsMultithreading() ? glTFRuntimeTaskScheduler::GetPool() : nullptr;
+	if (!Pool)
+	{
+		// keep the previous behaviour when a pool cannot be used
+		Async(EAsyncExecution::Thread, MoveTemp(Task));
+		return;
+	}
+
+	glTFRuntimeTaskScheduler::FQueuedTask* QueuedTask = new glTFRuntimeTaskScheduler::FQueuedTask(MoveTemp(Task));
+#if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 25
+	EQueuedWorkPriority QueuedWorkPriority = EQueuedWorkPriority::Normal;
+	if (Priority == EglTFRuntimeTaskPriority::High)
+	{
+		QueuedWorkPriority = EQueuedWorkPriority::High;
+	}
+	else if (Priority == EglTFRuntimeTaskPriority::Low)
+	{
+		QueuedWorkPriority = EQueuedWorkPriority::Low;
+	}
+	Pool->AddQueuedWork(QueuedTask, QueuedWorkPriority);
+#else
+	Pool->AddQueuedWork(QueuedTask);
+#endif
+}
+
+void FglTFRuntimeTaskScheduler::RunOnGameThread(TUniqueFunction<void()>&& Task)
+{
+	if (IsInGameThread())
+	{
+		Task();
+		return;
+	}
+
+	// without the ticker nobody would drain the queue
+	if (!glTFRuntimeTaskScheduler::TickerHandle.IsValid())
+	{
+		FGraphEventRef GraphTask = FFunctionGraphTask::CreateAndDispatchWhenReady(MoveTemp(Task), TStatId(), nullptr, ENamedThreads::GameThread);
+		FTaskGraphInterface::Get().WaitUntilTaskCompletes(GraphTask);
+		return;
+	}
+
+	glTFRuntimeTaskScheduler::FGameThreadTask GameThreadTask;
+	GameThreadTask.Task = MoveTemp(Task);
+	GameThreadTask.CompletedEvent = FPlatformProcess::GetSynchEventFromPool();
+
+	glTFRuntimeTaskScheduler::QueuedGameThreadTasks.Increment();
+	INC_DWORD_STAT(STAT_glTFRuntimeQueuedGameThreadTasks);
+	glTFRuntimeTaskScheduler::GameThreadTasks.Enqueue(&GameThreadTask);
+
+	GameThreadTask.CompletedEvent->Wait();
+	FPlatformProcess::ReturnSynchEventToPool(GameThreadTask.CompletedEvent);
+}
+
+int32 FglTFRuntimeTaskScheduler::GetQueuedTasks()
+{
+	return glTFRuntimeTaskScheduler::QueuedTasks.GetValue();
+}
+
+int32 FglTFRuntimeTaskScheduler::GetRunningTasks()
+{
+	return glTFRuntimeTaskScheduler::RunningTasks.GetValue();
+}
+
+int32 FglTFRuntimeTaskScheduler::GetQueuedGameThreadTasks()
+{
+	return glTFRuntimeTaskScheduler::QueuedGameThreadTasks.GetValue();
+}
+
+void FglTFRuntimeTaskScheduler::Startup()
+{
+#if ENGINE_MAJOR_VERSION > 4
+	glTFRuntimeTaskScheduler::TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&glTFRuntimeTaskScheduler::Tick));
+#else
+	glTFRuntimeTaskScheduler::TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&glTFRuntimeTaskScheduler::Tick));
+#endif
+}
+
+void FglTFRuntimeTaskScheduler::Shutdown()
+{
+	// workers may be waiting for the game thread, keep serving them until the pool is idle
+	while (glTFRuntimeTaskScheduler::QueuedTasks.GetValue() > 0 || glTFRuntimeTaskScheduler::RunningTasks.GetValue() > 0)
+	{
+		if (!glTFRuntimeTaskScheduler::RunGameThreadTask())
+		{
+			FPlatformProcess::Sleep(0.001f);
+		}
+	}
+
+	{
+		FScopeLock Lock(&glTFRuntimeTaskScheduler::PoolLock);
+		if (glTFRuntimeTaskScheduler::Pool)
+		{
+			glTFRuntimeTaskScheduler::Pool->Destroy();
+			delete glTFRuntimeTaskScheduler::Pool;
+			glTFRuntimeTaskScheduler::Pool = nullptr;
+		}
+	}
+
+	if (glTFRuntimeTaskScheduler::TickerHandle.IsValid())
+	{
+#if ENGINE_MAJOR_VERSION > 4
+		FTSTicker::GetCoreTicker().RemoveTicker(glTFRuntimeTaskScheduler::TickerHandle);
+#else
+		FTicker::GetCoreTicker().RemoveTicker(glTFRuntimeTaskScheduler::TickerHandle);
+#endif
+		glTFRuntimeTaskScheduler::TickerHandle.Reset();
+	}
+}
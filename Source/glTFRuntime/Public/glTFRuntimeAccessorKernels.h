@@ -0,0 +1,597 @@
+// Copyright 2020-2022, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+#include <arm_neon.h>
+#define GLTFRUNTIME_ACCESSOR_NEON 1
+#elif PLATFORM_ENABLE_VECTORINTRINSICS && PLATFORM_CPU_X86_FAMILY
+#include <emmintrin.h>
+#define GLTFRUNTIME_ACCESSOR_SSE 1
+#endif
+
+#ifndef GLTFRUNTIME_ACCESSOR_NEON
+#define GLTFRUNTIME_ACCESSOR_NEON 0
+#endif
+
+#ifndef GLTFRUNTIME_ACCESSOR_SSE
+#define GLTFRUNTIME_ACCESSOR_SSE 0
+#endif
+
+/*
+ * Decoding kernels for glTF accessors.
+ * Every (componentType, normalized, elements) combination is resolved to a dedicated
+ * template instance once per accessor, so the inner loops have no per-component branching.
+ * The conversion rules (and the results) are the same of the reference scalar path:
+ * normalized integers are divided (not multiplied by the reciprocal) and signed values are clamped to -1.
+ */
+
+template<typename SourceType, bool bNormalized>
+struct TglTFRuntimeAccessorComponent
+{
+	static FORCEINLINE float Convert(const SourceType Value)
+	{
+		return Value;
+	}
+};
+
+template<>
+struct TglTFRuntimeAccessorComponent<int8, true>
+{
+	static FORCEINLINE float Convert(const int8 Value)
+	{
+		return FMath::Max(((float)Value) / 127.f, -1.f);
+	}
+};
+
+template<>
+struct TglTFRuntimeAccessorComponent<uint8, true>
+{
+	static FORCEINLINE float Convert(const uint8 Value)
+	{
+		return ((float)Value) / 255.f;
+	}
+};
+
+template<>
+struct TglTFRuntimeAccessorComponent<int16, true>
+{
+	static FORCEINLINE float Convert(const int16 Value)
+	{
+		return FMath::Max(((float)Value) / 32767.f, -1.f);
+	}
+};
+
+template<>
+struct TglTFRuntimeAccessorComponent<uint16, true>
+{
+	static FORCEINLINE float Convert(const uint16 Value)
+	{
+		return ((float)Value) / 65535.f;
+	}
+};
+
+template<typename T>
+struct TglTFRuntimeAccessorStore
+{
+	using ComponentType = typename TDecay<decltype(DeclVal<T&>()[0])>::Type;
+
+	static FORCEINLINE void Set(T& Value, const int32 Index, const float Component)
+	{
+		Value[Index] = Component;
+	}
+};
+
+template<>
+struct TglTFRuntimeAccessorStore<float>
+{
+	using ComponentType = float;
+
+	static FORCEINLINE void Set(float& Value, const int32 Index, const float Component)
+	{
+		Value = Component;
+	}
+};
+
+template<>
+struct TglTFRuntimeAccessorStore<double>
+{
+	using ComponentType = double;
+
+	static FORCEINLINE void Set(double& Value, const int32 Index, const float Component)
+	{
+		Value = Component;
+	}
+};
+
+/*
+ * Basis change (and scale) applied to whole batches of decoded float3/float4 elements.
+ * Signed axis permutations (like the default glTF to UE basis) are reduced to a swizzle,
+ * everything else is a 4x4 row transform evaluated in the same order of FMatrix::TransformFVector4.
+ */
+struct FglTFRuntimeAccessorTransform
+{
+	float Rows[4][4];
+	float Scale;
+	float W;
+
+	bool bSwizzle;
+	int32 SwizzleAxis[3];
+	float SwizzleSign[3];
+
+	FglTFRuntimeAccessorTransform(const FMatrix& Matrix, const float InScale, const bool bTranslate)
+	{
+		for (int32 Row = 0; Row < 4; Row++)
+		{
+			for (int32 Column = 0; Column < 4; Column++)
+			{
+				Rows[Row][Column] = (float)Matrix.M[Row][Column];
+			}
+		}
+		Scale = InScale;
+		W = bTranslate ? 1.f : 0.f;
+
+		bSwizzle = Rows[3][3] == 1.f && Rows[3][0] == 0.f && Rows[3][1] == 0.f && Rows[3][2] == 0.f;
+		for (int32 Column = 0; Column < 3 && bSwizzle; Column++)
+		{
+			SwizzleAxis[Column] = INDEX_NONE;
+			for (int32 Row = 0; Row < 3; Row++)
+			{
+				if (Rows[Row][Column] == 0.f)
+				{
+					continue;
+				}
+				if (SwizzleAxis[Column] != INDEX_NONE || FMath::Abs(Rows[Row][Column]) != 1.f)
+				{
+					bSwizzle = false;
+					break;
+				}
+				SwizzleAxis[Column] = Row;
+				SwizzleSign[Column] = Rows[Row][Column];
+			}
+			bSwizzle = bSwizzle && SwizzleAxis[Column] != INDEX_NONE && Rows[Column][3] == 0.f;
+		}
+		if (bSwizzle)
+		{
+			bSwizzle = SwizzleAxis[0] != SwizzleAxis[1] && SwizzleAxis[0] != SwizzleAxis[2] && SwizzleAxis[1] != SwizzleAxis[2];
+		}
+	}
+
+	// Source and Destination must not overlap, Destination requires one float of padding for 3 elements vectors
+	template<int32 Elements>
+	void Apply(const float* Source, const int64 Num, float* Destination) const
+	{
+		static_assert(Elements == 3 || Elements == 4, "Only 3 and 4 elements vectors can be transformed");
+
+		if (bSwizzle)
+		{
+			for (int64 Index = 0; Index < Num; Index++)
+			{
+				const float* In = Source + Index * Elements;
+				float* Out = Destination + Index * Elements;
+				Out[0] = (In[SwizzleAxis[0]] * SwizzleSign[0]) * Scale;
+				Out[1] = (In[SwizzleAxis[1]] * SwizzleSign[1]) * Scale;
+				Out[2] = (In[SwizzleAxis[2]] * SwizzleSign[2]) * Scale;
+				if (Elements == 4)
+				{
+					Out[3] = In[3];
+				}
+			}
+			return;
+		}
+
+#if GLTFRUNTIME_ACCESSOR_SSE
+		const __m128 Row0 = _mm_loadu_ps(Rows[0]);
+		const __m128 Row1 = _mm_loadu_ps(Rows[1]);
+		const __m128 Row2 = _mm_loadu_ps(Rows[2]);
+		const __m128 Row3 = _mm_loadu_ps(Rows[3]);
+		const __m128 ScaleXYZ = _mm_setr_ps(Scale, Scale, Scale, 1.f);
+		for (int64 Index = 0; Index < Num; Index++)
+		{
+			const float* In = Source + Index * Elements;
+			const __m128 XY = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(In[0]), Row0), _mm_mul_ps(_mm_set1_ps(In[1]), Row1));
+			const __m128 ZW = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(In[2]), Row2), _mm_mul_ps(_mm_set1_ps(Elements == 4 ? In[3] : W), Row3));
+			_mm_storeu_ps(Destination + Index * Elements, _mm_mul_ps(_mm_add_ps(XY, ZW), ScaleXYZ));
+		}
+#elif GLTFRUNTIME_ACCESSOR_NEON
+		const float32x4_t Row0 = vld1q_f32(Rows[0]);
+		const float32x4_t Row1 = vld1q_f32(Rows[1]);
+		const float32x4_t Row2 = vld1q_f32(Rows[2]);
+		const float32x4_t Row3 = vld1q_f32(Rows[3]);
+		const float ScaleValues[4] = { Scale, Scale, Scale, 1.f };
+		const float32x4_t ScaleXYZ = vld1q_f32(ScaleValues);
+		for (int64 Index = 0; Index < Num; Index++)
+		{
+			const float* In = Source + Index * Elements;
+			const float32x4_t XY = vaddq_f32(vmulq_n_f32(Row0, In[0]), vmulq_n_f32(Row1, In[1]));
+			const float32x4_t ZW = vaddq_f32(vmulq_n_f32(Row2, In[2]), vmulq_n_f32(Row3, Elements == 4 ? In[3] : W));
+			vst1q_f32(Destination + Index * Elements, vmulq_f32(vaddq_f32(XY, ZW), ScaleXYZ));
+		}
+#else
+		for (int64 Index = 0; Index < Num; Index++)
+		{
+			const float* In = Source + Index * Elements;
+			float* Out = Destination + Index * Elements;
+			const float InW = Elements == 4 ? In[3] : W;
+			for (int32 Column = 0; Column < Elements; Column++)
+			{
+				const float Value = (In[0] * Rows[0][Column] + In[1] * Rows[1][Column]) + (In[2] * Rows[2][Column] + InW * Rows[3][Column]);
+				Out[Column] = Column < 3 ? Value * Scale : Value;
+			}
+		}
+#endif
+	}
+};
+
+struct FglTFRuntimeAccessorKernels
+{
+	// elements decoded per batch (the components are staged in a float buffer on the stack)
+	enum { BatchSize = 256 };
+
+	template<typename SourceType, bool bNormalized>
+	static void ConvertRunScalar(const SourceType* Source, const int64 Num, float* Destination)
+	{
+		for (int64 Index = 0; Index < Num; Index++)
+		{
+			Destination[Index] = TglTFRuntimeAccessorComponent<SourceType, bNormalized>::Convert(Source[Index]);
+		}
+	}
+
+#if GLTFRUNTIME_ACCESSOR_SSE
+	template<typename SourceType>
+	static FORCEINLINE __m128i Load4(const SourceType* Source);
+
+	template<bool bNormalized, bool bSigned>
+	static FORCEINLINE __m128 Normalize(const __m128 Value, const float Divisor)
+	{
+		if (!bNormalized)
+		{
+			return Value;
+		}
+		const __m128 Result = _mm_div_ps(Value, _mm_set1_ps(Divisor));
+		return bSigned ? _mm_max_ps(Result, _mm_set1_ps(-1.f)) : Result;
+	}
+#endif
+
+#if GLTFRUNTIME_ACCESSOR_NEON
+	template<bool bNormalized, bool bSigned>
+	static FORCEINLINE float32x4_t Normalize(const float32x4_t Value, const float Divisor)
+	{
+		if (!bNormalized)
+		{
+			return Value;
+		}
+		const float32x4_t Result = vdivq_f32(Value, vdupq_n_f32(Divisor));
+		return bSigned ? vmaxq_f32(Result, vdupq_n_f32(-1.f)) : Result;
+	}
+
+	template<typename SourceType>
+	static FORCEINLINE float32x4_t Load4(const SourceType* Source);
+#endif
+
+	// convert a contiguous run of components
+	template<typename SourceType, bool bNormalized>
+	static void ConvertRun(const SourceType* Source, const int64 Num, float* Destination)
+	{
+		int64 Index = 0;
+#if GLTFRUNTIME_ACCESSOR_SSE || GLTFRUNTIME_ACCESSOR_NEON
+		constexpr bool bSigned = TIsSame<SourceType, int8>::Value || TIsSame<SourceType, int16>::Value;
+		constexpr float Divisor = sizeof(SourceType) == 1 ? (bSigned ? 127.f : 255.f) : (bSigned ? 32767.f : 65535.f);
+		if (!TIsSame<SourceType, float>::Value)
+		{
+			for (; Index + 4 <= Num; Index += 4)
+			{
+#if GLTFRUNTIME_ACCESSOR_SSE
+				_mm_storeu_ps(Destination + Index, Normalize<bNormalized, bSigned>(_mm_cvtepi32_ps(Load4(Source + Index)), Divisor));
+#else
+				vst1q_f32(Destination + Index, Normalize<bNormalized, bSigned>(Load4(Source + Index), Divisor));
+#endif
+			}
+		}
+#endif
+		ConvertRunScalar<SourceType, bNormalized>(Source + Index, Num - Index, Destination + Index);
+	}
+
+	template<typename SourceType, bool bNormalized, int32 Elements>
+	static void ConvertBatch(const uint8* Source, const int64 Stride, const int64 Num, float* Destination)
+	{
+		if (Stride == sizeof(SourceType) * Elements)
+		{
+			if (TIsSame<SourceType, float>::Value)
+			{
+				FMemory::Memcpy(Destination, Source, Num * Elements * sizeof(float));
+			}
+			else
+			{
+				ConvertRun<SourceType, bNormalized>(reinterpret_cast<const SourceType*>(Source), Num * Elements, Destination);
+			}
+			return;
+		}
+
+		for (int64 ElementIndex = 0; ElementIndex < Num; ElementIndex++)
+		{
+			const SourceType* Ptr = reinterpret_cast<const SourceType*>(Source + ElementIndex * Stride);
+			for (int32 ComponentIndex = 0; ComponentIndex < Elements; ComponentIndex++)
+			{
+				Destination[ElementIndex * Elements + ComponentIndex] = TglTFRuntimeAccessorComponent<SourceType, bNormalized>::Convert(Ptr[ComponentIndex]);
+			}
+		}
+	}
+
+	template<int32 Elements>
+	static FORCEINLINE const float* TransformBatch(const FglTFRuntimeAccessorTransform& Transform, const float* Source, const int64 Num, float* Destination)
+	{
+		Transform.Apply<Elements>(Source, Num, Destination);
+		return Destination;
+	}
+
+	template<typename T, typename SourceType, bool bNormalized, int32 Elements>
+	static void DecodeTyped(const uint8* Source, const int64 Stride, const int64 Count, T* Destination, const FglTFRuntimeAccessorTransform* Transform)
+	{
+		// packed floats already matching the destination layout
+		if (!Transform && TIsSame<SourceType, float>::Value && sizeof(T) == sizeof(float) * Elements && Stride == sizeof(float) * Elements && TIsSame<typename TglTFRuntimeAccessorStore<T>::ComponentType, float>::Value)
+		{
+			FMemory::Memcpy(Destination, Source, Count * sizeof(T));
+			return;
+		}
+
+		float Components[BatchSize * Elements];
+		float TransformedComponents[BatchSize * Elements + 1];
+		for (int64 Base = 0; Base < Count; Base += BatchSize)
+		{
+			const int64 Num = FMath::Min<int64>(BatchSize, Count - Base);
+			ConvertBatch<SourceType, bNormalized, Elements>(Source + Base * Stride, Stride, Num, Components);
+			const float* Decoded = Components;
+			if (Transform && (Elements == 3 || Elements == 4))
+			{
+				Decoded = TransformBatch<Elements == 4 ? 4 : 3>(*Transform, Components, Num, TransformedComponents);
+			}
+			for (int64 ElementIndex = 0; ElementIndex < Num; ElementIndex++)
+			{
+				T Value;
+				for (int32 ComponentIndex = 0; ComponentIndex < Elements; ComponentIndex++)
+				{
+					TglTFRuntimeAccessorStore<T>::Set(Value, ComponentIndex, Decoded[ElementIndex * Elements + ComponentIndex]);
+				}
+				Destination[Base + ElementIndex] = Value;
+			}
+		}
+	}
+
+	template<typename T, typename SourceType, bool bNormalized>
+	static bool DecodeElements(const int64 Elements, const uint8* Source, const int64 Stride, const int64 Count, T* Destination, const FglTFRuntimeAccessorTransform* Transform)
+	{
+		switch (Elements)
+		{
+		case 1:
+			DecodeTyped<T, SourceType, bNormalized, 1>(Source, Stride, Count, Destination, Transform);
+			return true;
+		case 2:
+			DecodeTyped<T, SourceType, bNormalized, 2>(Source, Stride, Count, Destination, Transform);
+			return true;
+		case 3:
+			DecodeTyped<T, SourceType, bNormalized, 3>(Source, Stride, Count, Destination, Transform);
+			return true;
+		case 4:
+			DecodeTyped<T, SourceType, bNormalized, 4>(Source, Stride, Count, Destination, Transform);
+			return true;
+		default:
+			break;
+		}
+		return false;
+	}
+
+	template<typename T, typename SourceType>
+	static bool DecodeNormalized(const bool bNormalized, const int64 Elements, const uint8* Source, const int64 Stride, const int64 Count, T* Destination, const FglTFRuntimeAccessorTransform* Transform)
+	{
+		if (bNormalized)
+		{
+			return DecodeElements<T, SourceType, true>(Elements, Source, Stride, Count, Destination, Transform);
+		}
+		return DecodeElements<T, SourceType, false>(Elements, Source, Stride, Count, Destination, Transform);
+	}
+
+	template<typename SourceType>
+	static void WidenIndices(const SourceType* Source, const int64 Count, uint32* Destination)
+	{
+		int64 Index = 0;
+#if GLTFRUNTIME_ACCESSOR_SSE
+		const __m128i Zero = _mm_setzero_si128();
+		if (sizeof(SourceType) == 1)
+		{
+			for (; Index + 16 <= Count; Index += 16)
+			{
+				const __m128i Bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + Index));
+				const __m128i Low = _mm_unpacklo_epi8(Bytes, Zero);
+				const __m128i High = _mm_unpackhi_epi8(Bytes, Zero);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Destination + Index), _mm_unpacklo_epi16(Low, Zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Destination + Index + 4), _mm_unpackhi_epi16(Low, Zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Destination + Index + 8), _mm_unpacklo_epi16(High, Zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Destination + Index + 12), _mm_unpackhi_epi16(High, Zero));
+			}
+		}
+		else if (sizeof(SourceType) == 2)
+		{
+			for (; Index + 8 <= Count; Index += 8)
+			{
+				const __m128i Words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + Index));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Destination + Index), _mm_unpacklo_epi16(Words, Zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Destination + Index + 4), _mm_unpackhi_epi16(Words, Zero));
+			}
+		}
+#elif GLTFRUNTIME_ACCESSOR_NEON
+		if (sizeof(SourceType) == 1)
+		{
+			for (; Index + 8 <= Count; Index += 8)
+			{
+				const uint16x8_t Words = vmovl_u8(vld1_u8(reinterpret_cast<const uint8*>(Source + Index)));
+				vst1q_u32(Destination + Index, vmovl_u16(vget_low_u16(Words)));
+				vst1q_u32(Destination + Index + 4, vmovl_u16(vget_high_u16(Words)));
+			}
+		}
+		else if (sizeof(SourceType) == 2)
+		{
+			for (; Index + 4 <= Count; Index += 4)
+			{
+				vst1q_u32(Destination + Index, vmovl_u16(vld1_u16(reinterpret_cast<const uint16*>(Source + Index))));
+			}
+		}
+#endif
+		for (; Index < Count; Index++)
+		{
+			Destination[Index] = Source[Index];
+		}
+	}
+
+	template<typename SourceType>
+	static void DecodeIndicesTyped(const uint8* Source, const int64 Stride, const int64 Count, uint32* Destination)
+	{
+		if (Stride == sizeof(SourceType))
+		{
+			if (sizeof(SourceType) == sizeof(uint32))
+			{
+				FMemory::Memcpy(Destination, Source, Count * sizeof(uint32));
+			}
+			else
+			{
+				WidenIndices(reinterpret_cast<const SourceType*>(Source), Count, Destination);
+			}
+			return;
+		}
+
+		for (int64 Index = 0; Index < Count; Index++)
+		{
+			SourceType Value;
+			FMemory::Memcpy(&Value, Source + Index * Stride, sizeof(SourceType));
+			Destination[Index] = Value;
+		}
+	}
+
+	// Decode Count indices (UNSIGNED_BYTE, UNSIGNED_SHORT or UNSIGNED_INT) into Destination.
+	static bool DecodeIndices(const int64 ComponentType, const uint8* Source, const int64 Stride, const int64 Count, uint32* Destination)
+	{
+		switch (ComponentType)
+		{
+		case 5121:
+			DecodeIndicesTyped<uint8>(Source, Stride, Count, Destination);
+			return true;
+		case 5123:
+			DecodeIndicesTyped<uint16>(Source, Stride, Count, Destination);
+			return true;
+		case 5125:
+			DecodeIndicesTyped<uint32>(Source, Stride, Count, Destination);
+			return true;
+		default:
+			break;
+		}
+		return false;
+	}
+
+	// Decode Count elements of an accessor into Destination (that must have room for Count items).
+	// The optional Transform is applied to 3 and 4 elements accessors.
+	template<typename T>
+	static bool Decode(const int64 ComponentType, const bool bNormalized, const int64 Elements, const uint8* Source, const int64 Stride, const int64 Count, T* Destination, const FglTFRuntimeAccessorTransform* Transform = nullptr)
+	{
+		switch (ComponentType)
+		{
+			// FLOAT
+		case 5126:
+			return DecodeElements<T, float, false>(Elements, Source, Stride, Count, Destination, Transform);
+			// BYTE
+		case 5120:
+			return DecodeNormalized<T, int8>(bNormalized, Elements, Source, Stride, Count, Destination, Transform);
+			// UNSIGNED_BYTE
+		case 5121:
+			return DecodeNormalized<T, uint8>(bNormalized, Elements, Source, Stride, Count, Destination, Transform);
+			// SHORT
+		case 5122:
+			return DecodeNormalized<T, int16>(bNormalized, Elements, Source, Stride, Count, Destination, Transform);
+			// UNSIGNED_SHORT
+		case 5123:
+			return DecodeNormalized<T, uint16>(bNormalized, Elements, Source, Stride, Count, Destination, Transform);
+		default:
+			break;
+		}
+		return false;
+	}
+};
+
+#if GLTFRUNTIME_ACCESSOR_SSE
+template<>
+FORCEINLINE __m128i FglTFRuntimeAccessorKernels::Load4<int8>(const int8* Source)
+{
+	int32 Packed;
+	FMemory::Memcpy(&Packed, Source, sizeof(int32));
+	const __m128i Bytes = _mm_cvtsi32_si128(Packed);
+	const __m128i Words = _mm_srai_epi16(_mm_unpacklo_epi8(Bytes, Bytes), 8);
+	return _mm_srai_epi32(_mm_unpacklo_epi16(Words, Words), 16);
+}
+
+template<>
+FORCEINLINE __m128i FglTFRuntimeAccessorKernels::Load4<uint8>(const uint8* Source)
+{
+	int32 Packed;
+	FMemory::Memcpy(&Packed, Source, sizeof(int32));
+	const __m128i Zero = _mm_setzero_si128();
+	return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(Packed), Zero), Zero);
+}
+
+template<>
+FORCEINLINE __m128i FglTFRuntimeAccessorKernels::Load4<int16>(const int16* Source)
+{
+	const __m128i Words = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(Source));
+	return _mm_srai_epi32(_mm_unpacklo_epi16(Words, Words), 16);
+}
+
+template<>
+FORCEINLINE __m128i FglTFRuntimeAccessorKernels::Load4<uint16>(const uint16* Source)
+{
+	return _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(Source)), _mm_setzero_si128());
+}
+
+template<>
+FORCEINLINE __m128i FglTFRuntimeAccessorKernels::Load4<float>(const float* Source)
+{
+	return _mm_setzero_si128();
+}
+#endif
+
+#if GLTFRUNTIME_ACCESSOR_NEON
+template<>
+FORCEINLINE float32x4_t FglTFRuntimeAccessorKernels::Load4<int8>(const int8* Source)
+{
+	int32 Packed;
+	FMemory::Memcpy(&Packed, Source, sizeof(int32));
+	const int16x8_t Words = vmovl_s8(vreinterpret_s8_s32(vdup_n_s32(Packed)));
+	return vcvtq_f32_s32(vmovl_s16(vget_low_s16(Words)));
+}
+
+template<>
+FORCEINLINE float32x4_t FglTFRuntimeAccessorKernels::Load4<uint8>(const uint8* Source)
+{
+	int32 Packed;
+	FMemory::Memcpy(&Packed, Source, sizeof(int32));
+	const uint16x8_t Words = vmovl_u8(vreinterpret_u8_s32(vdup_n_s32(Packed)));
+	return vcvtq_f32_u32(vmovl_u16(vget_low_u16(Words)));
+}
+
+template<>
+FORCEINLINE float32x4_t FglTFRuntimeAccessorKernels::Load4<int16>(const int16* Source)
+{
+	return vcvtq_f32_s32(vmovl_s16(vld1_s16(Source)));
+}
+
+template<>
+FORCEINLINE float32x4_t FglTFRuntimeAccessorKernels::Load4<uint16>(const uint16* Source)
+{
+	return vcvtq_f32_u32(vmovl_u16(vld1_u16(Source)));
+}
+
+template<>
+FORCEINLINE float32x4_t FglTFRuntimeAccessorKernels::Load4<float>(const float* Source)
+{
+	return vld1q_f32(Source);
+}
+#endif
@@ -88,6 +88,9 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "glTFRuntime")
 	TArray<FString> GetCamerasNames();
 
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "glTFRuntime")
+	TArray<FString> GetAnimationsNames();
+
 	UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject"), Category = "glTFRuntime")
 	ACameraActor* LoadNodeCamera(UObject* WorldContextObject, const int32 NodeIndex, TSubclassOf<ACameraActor> CameraActorClass);
 
@@ -130,6 +133,9 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "glTFRuntime")
 	FglTFRuntimeOnStaticMeshCreated OnStaticMeshCreated;
 
+	UPROPERTY(BlueprintAssignable, Category = "glTFRuntime")
+	FglTFRuntimeOnStaticMeshCreated OnStaticMeshPhysicsCooked;
+
 	UPROPERTY(BlueprintAssignable, Category = "glTFRuntime")
 	FglTFRuntimeOnSkeletalMeshCreated OnSkeletalMeshCreated;
 
@@ -139,6 +145,9 @@ public:
 	UFUNCTION()
 	void OnStaticMeshCreatedProxy(UStaticMesh* StaticMesh);
 
+	UFUNCTION()
+	void OnStaticMeshPhysicsCookedProxy(UStaticMesh* StaticMesh);
+
 	UFUNCTION()
 	void OnSkeletalMeshCreatedProxy(USkeletalMesh* SkeletalMesh);
 
@@ -39,6 +39,12 @@ protected:
 	TArray<USkeletalMeshComponent*> DiscoveredSkeletalMeshComponents;
 	bool bAllowNodeAnimations;
 
+	// components waiting for the background collision cooking of their mesh
+	TMap<UStaticMesh*, TArray<TWeakObjectPtr<UStaticMeshComponent>>> StaticMeshComponentsCooking;
+
+	UFUNCTION()
+	void OnStaticMeshPhysicsCooked(UStaticMesh* StaticMesh);
+
 public:	
 	// Called every frame
 	virtual void Tick(float DeltaTime) override;
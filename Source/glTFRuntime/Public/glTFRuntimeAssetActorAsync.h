@@ -7,6 +7,30 @@
 #include "glTFRuntimeAsset.h"
 #include "glTFRuntimeAssetActorAsync.generated.h"
 
+class AglTFRuntimeAssetActorAsync;
+class UStaticMeshComponent;
+
+// binds an async mesh load to the components that will receive the mesh
+UCLASS()
+class GLTFRUNTIME_API UglTFRuntimeAssetActorAsyncMeshRequest : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	AglTFRuntimeAssetActorAsync* Actor;
+
+	// nodes sharing the same mesh (and skin) wait for the same request
+	UPROPERTY()
+	TArray<UPrimitiveComponent*> PrimitiveComponents;
+
+	UFUNCTION()
+	void LoadStaticMeshAsync(UStaticMesh* StaticMesh);
+
+	UFUNCTION()
+	void LoadSkeletalMeshAsync(USkeletalMesh* SkeletalMesh);
+};
+
 UCLASS()
 class GLTFRUNTIME_API AglTFRuntimeAssetActorAsync : public AActor
 {
@@ -39,6 +63,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime")
 	FglTFRuntimeSkeletalMeshConfig SkeletalMeshConfig;
 
+	// max number of meshes loaded at the same time
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true, ClampMin = 1), Category = "glTFRuntime")
+	int32 MaxConcurrentMeshes;
+
 	UFUNCTION(BlueprintNativeEvent, Category = "glTFRuntime", meta = (DisplayName = "On Scenes Loaded"))
 	void ReceiveOnScenesLoaded();
 
@@ -48,15 +76,20 @@ private:
 
 	TMap<UPrimitiveComponent*, FglTFRuntimeNode> MeshesToLoad;
 
+	// requests are kept referenced until their mesh has been assigned
+	UPROPERTY()
+	TArray<UglTFRuntimeAssetActorAsyncMeshRequest*> MeshesLoading;
+
 	void LoadNextMeshAsync();
 
-	UFUNCTION()
-	void LoadStaticMeshAsync(UStaticMesh* StaticMesh);
+	void OnMeshLoaded(UglTFRuntimeAssetActorAsyncMeshRequest* MeshRequest);
+
+	// components waiting for the background collision cooking of their mesh
+	TMap<UStaticMesh*, TArray<TWeakObjectPtr<UStaticMeshComponent>>> StaticMeshComponentsCooking;
 
 	UFUNCTION()
-	void LoadSkeletalMeshAsync(USkeletalMesh* SkeletalMesh);
+	void OnStaticMeshPhysicsCooked(UStaticMesh* StaticMesh);
 
-	// this is safe to share between game and async threads because everything is sequential
-	UPrimitiveComponent* CurrentPrimitiveComponent;
+	friend class UglTFRuntimeAssetActorAsyncMeshRequest;
 
 };
@@ -15,6 +15,9 @@
 #include "Rendering/SkeletalMeshLODImporterData.h"
 #endif
 #include "Serialization/ArrayReader.h"
+#include "Async/MappedFileHandle.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "glTFRuntimeAccessorKernels.h"
 #include "glTFRuntimeParser.generated.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogGLTFRuntime, Log, All);
@@ -121,6 +124,34 @@ struct FglTFRuntimeConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	FString ArchiveAutoEntryPointExtensions;
 
+	// map the whole .gltf/.glb file (LoadFromFilename) instead of reading it, buffers reference the mapping, falls back to LoadFileToArray when mapping fails
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bUseMemoryMappedFile;
+
+	// GLB only: read just the json chunk when opening the file, BIN chunk ranges are read on demand when a bufferView is requested
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bStreamBinaryChunk;
+
+	// memory budget (in megabytes) for the bufferViews read from a streamed GLB, least recently used ones are evicted first
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 StreamedBufferViewsCacheMaxSizeMB;
+
+	// parse only the json part (scenes, nodes, names...), buffers and base materials are never loaded
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bMetadataOnly;
+
+	// build the json DOM directly from the UTF-8 bytes, without converting the whole document to an FString
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bUseUTF8JsonParser;
+
+	// memory budget (in megabytes) for keeping decoded accessors shared by multiple primitives/samplers, 0 disables the cache
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 DecodedAccessorsCacheMaxSizeMB;
+
+	// memory budget (in megabytes) for the decoded EXT_meshopt_compression bufferViews, least recently used ones are evicted first
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 DecodedBufferViewsCacheMaxSizeMB;
+
 	bool bSearchContentDir;
 
 	FglTFRuntimeConfig()
@@ -133,6 +164,13 @@ struct FglTFRuntimeConfig
 		bAllowExternalFiles = false;
 		bOverrideBaseDirectoryFromContentDir = false;
 		ArchiveAutoEntryPointExtensions = ".glb .gltf .json .js";
+		bUseMemoryMappedFile = false;
+		bStreamBinaryChunk = false;
+		StreamedBufferViewsCacheMaxSizeMB = 64;
+		bMetadataOnly = false;
+		bUseUTF8JsonParser = false;
+		DecodedAccessorsCacheMaxSizeMB = 64;
+		DecodedBufferViewsCacheMaxSizeMB = 64;
 	}
 
 	FMatrix GetMatrix() const
@@ -255,6 +293,14 @@ enum class EglTFRuntimeCacheMode : uint8
 	Write
 };
 
+UENUM()
+enum class EglTFRuntimeTaskPriority : uint8
+{
+	High,
+	Normal,
+	Low,
+};
+
 UENUM()
 enum class EglTFRuntimePivotPosition : uint8
 {
@@ -413,6 +459,25 @@ struct FglTFRuntimeMaterialsConfig
 	}
 };
 
+USTRUCT(BlueprintType)
+struct FglTFRuntimeGeneratedLOD
+{
+	GENERATED_BODY()
+
+	// fraction of the LOD0 triangles to keep
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime", meta = (ClampMin = 0, ClampMax = 1))
+	float TriangleRatio;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float ScreenSize;
+
+	FglTFRuntimeGeneratedLOD()
+	{
+		TriangleRatio = 0.5f;
+		ScreenSize = 0.5f;
+	}
+};
+
 USTRUCT(BlueprintType)
 struct FglTFRuntimeStaticMeshConfig
 {
@@ -421,6 +486,10 @@ struct FglTFRuntimeStaticMeshConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	EglTFRuntimeCacheMode CacheMode;
 
+	// position of async loads in the shared worker pool queue (higher priority loads are started first)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	EglTFRuntimeTaskPriority AsyncPriority;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bReverseWinding;
 
@@ -433,12 +502,38 @@ struct FglTFRuntimeStaticMeshConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	TArray<FVector4> SphereCollisions;
 
+	// approximate LOD0 with a set of convex hulls (simple collision), the most concave group of triangles is recursively split in two
+	// note: this is surface clustering, not a volumetric (V-HACD like) decomposition, each hull wraps a group of triangles
+	// so cavities below ConvexDecompositionMaxConcavity get filled, use an offline tool when accurate concave collision is required
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bBuildConvexDecomposition;
+
+	// max number of hulls for the whole mesh (all of the LOD0 sections share them)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime", meta = (ClampMin = 1))
+	int32 ConvexDecompositionMaxHulls;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime", meta = (ClampMin = 4, ClampMax = 255))
+	int32 ConvexDecompositionMaxHullVertices;
+
+	// a hull is not split anymore when the depth of its deepest cavity is below this fraction of the mesh bounds diagonal
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime", meta = (ClampMin = 0))
+	float ConvexDecompositionMaxConcavity;
+
+	// number of candidate split planes (evenly spaced) evaluated along each axis when splitting a hull
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime", meta = (ClampMin = 1))
+	int32 ConvexDecompositionSplitPlanes;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	TEnumAsByte<ECollisionTraceFlag> CollisionComplexity;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bAllowCPUAccess;
 
+	// cook collision in background, the mesh is returned immediately and gets collision when OnStaticMeshPhysicsCooked is triggered
+	// components already using the mesh must call RecreatePhysicsState() from that event (the glTFRuntime actors do it for their components)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bAsyncPhysicsCooking;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	EglTFRuntimePivotPosition PivotPosition;
 
@@ -457,31 +552,94 @@ struct FglTFRuntimeStaticMeshConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	TMap<int32, float> LODScreenSize;
 
+	// LODs simplified from LOD0 and appended after the source ones (LODScreenSize still wins if specified)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	TArray<FglTFRuntimeGeneratedLOD> GeneratedLODs;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	EglTFRuntimeNormalsGenerationStrategy NormalsGenerationStrategy;
 
+	// generated normals are averaged (angle weighted) between faces sharing a position instead of being flat, the mesh stays indexed
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bGenerateSmoothNormals;
+
+	// faces whose normals differ by more than this angle (in degrees) are not smoothed together
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime", meta = (ClampMin = 0, ClampMax = 180))
+	float NormalsCreaseAngle;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	EglTFRuntimeTangentsGenerationStrategy TangentsGenerationStrategy;
 
+	// sections whose glTF material has no normal map get a plain orthogonal tangent basis instead of generated tangents
+	// (materials replaced by the override maps are always assumed to use one)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bSkipTangentsWithoutNormalMap;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bReverseTangents;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bUseHighPrecisionUVs;
 
+	// merge the vertices of non-indexed primitives whose position, normal and uvs are within the epsilons
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bWeldVertices;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float WeldPositionEpsilon;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float WeldNormalEpsilon;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float WeldUVEpsilon;
+
+	// reorder triangles for the post transform vertex cache
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bOptimizeVertexCache;
+
+	// reorder clusters of triangles to reduce overdraw, a cluster can be up to OverdrawThreshold times worse for the vertex cache
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bOptimizeOverdraw;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime", meta = (ClampMin = 1))
+	float OverdrawThreshold;
+
+	// reorder vertices in the order they are used by the triangles
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bOptimizeVertexFetch;
+
 	FglTFRuntimeStaticMeshConfig()
 	{
 		CacheMode = EglTFRuntimeCacheMode::ReadWrite;
+		AsyncPriority = EglTFRuntimeTaskPriority::Normal;
 		bReverseWinding = false;
 		bBuildSimpleCollision = false;
+		bBuildConvexDecomposition = false;
+		ConvexDecompositionMaxHulls = 8;
+		ConvexDecompositionMaxHullVertices = 16;
+		ConvexDecompositionMaxConcavity = 0.02f;
+		ConvexDecompositionSplitPlanes = 15;
 		Outer = nullptr;
 		CollisionComplexity = ECollisionTraceFlag::CTF_UseDefault;
 		bAllowCPUAccess = false;
+		bAsyncPhysicsCooking = false;
 		PivotPosition = EglTFRuntimePivotPosition::Asset;
 		NormalsGenerationStrategy = EglTFRuntimeNormalsGenerationStrategy::IfMissing;
+		bGenerateSmoothNormals = false;
+		NormalsCreaseAngle = 60;
 		TangentsGenerationStrategy = EglTFRuntimeTangentsGenerationStrategy::IfMissing;
+		bSkipTangentsWithoutNormalMap = false;
 		bReverseTangents = false;
 		bUseHighPrecisionUVs = false;
+		bWeldVertices = false;
+		WeldPositionEpsilon = 0.001f;
+		WeldNormalEpsilon = 0.001f;
+		WeldUVEpsilon = 0.0001f;
+		bOptimizeVertexCache = false;
+		bOptimizeOverdraw = false;
+		OverdrawThreshold = 1.05f;
+		bOptimizeVertexFetch = false;
 	}
 };
 
@@ -625,6 +783,10 @@ struct FglTFRuntimeSkeletalMeshConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	EglTFRuntimeCacheMode CacheMode;
 
+	// position of async loads in the shared worker pool queue (higher priority loads are started first)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	EglTFRuntimeTaskPriority AsyncPriority;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	USkeleton* Skeleton;
 
@@ -652,6 +814,10 @@ struct FglTFRuntimeSkeletalMeshConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	TMap<int32, float> LODScreenSize;
 
+	// LODs simplified from LOD0 and appended after the source ones (LODScreenSize still wins if specified)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	TArray<FglTFRuntimeGeneratedLOD> GeneratedLODs;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	FVector BoundsScale;
 
@@ -688,9 +854,55 @@ struct FglTFRuntimeSkeletalMeshConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bUseHighPrecisionUVs;
 
+	// primitives without normals get angle weighted smooth normals instead of flat ones, the mesh stays indexed
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bGenerateSmoothNormals;
+
+	// faces whose normals differ by more than this angle (in degrees) are not smoothed together
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime", meta = (ClampMin = 0, ClampMax = 180))
+	float NormalsCreaseAngle;
+
+	// primitives without tangents get them generated (on the shared vertices) before building the mesh,
+	// or just an orthogonal basis when bSkipTangentsWithoutNormalMap is set and the material has no normal map
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bGenerateTangents;
+
+	// materials replaced by the override maps are always assumed to use a normal map
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bSkipTangentsWithoutNormalMap;
+
+	// merge the vertices of non-indexed primitives whose position, normal and uvs are within the epsilons
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bWeldVertices;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float WeldPositionEpsilon;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float WeldNormalEpsilon;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	float WeldUVEpsilon;
+
+	// reorder triangles for the post transform vertex cache
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bOptimizeVertexCache;
+
+	// reorder clusters of triangles to reduce overdraw, a cluster can be up to OverdrawThreshold times worse for the vertex cache
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bOptimizeOverdraw;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime", meta = (ClampMin = 1))
+	float OverdrawThreshold;
+
+	// reorder vertices in the order they are used by the triangles
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bOptimizeVertexFetch;
+
 	FglTFRuntimeSkeletalMeshConfig()
 	{
 		CacheMode = EglTFRuntimeCacheMode::ReadWrite;
+		AsyncPriority = EglTFRuntimeTaskPriority::Normal;
 		bOverwriteRefSkeleton = false;
 		Skeleton = nullptr;
 		bIgnoreSkin = false;
@@ -706,6 +918,18 @@ struct FglTFRuntimeSkeletalMeshConfig
 		MorphTargetsDuplicateStrategy = EglTFRuntimeMorphTargetsDuplicateStrategy::Ignore;
 		ShiftBounds = FVector::ZeroVector;
 		bUseHighPrecisionUVs = false;
+		bGenerateSmoothNormals = false;
+		NormalsCreaseAngle = 60;
+		bGenerateTangents = true;
+		bSkipTangentsWithoutNormalMap = false;
+		bWeldVertices = false;
+		WeldPositionEpsilon = 0.001f;
+		WeldNormalEpsilon = 0.001f;
+		WeldUVEpsilon = 0.0001f;
+		bOptimizeVertexCache = false;
+		bOptimizeOverdraw = false;
+		OverdrawThreshold = 1.05f;
+		bOptimizeVertexFetch = false;
 	}
 };
 
@@ -800,6 +1024,10 @@ struct FglTFRuntimePrimitive
 	TMap<int32, FName> OverrideBoneMap;
 	TMap<int32, int32> BonesCache;
 	FString MaterialName;
+	// the primitive had no indices accessor, Indices is just the 0..N-1 sequence
+	bool bHasSynthesizedIndices = false;
+	// the material may sample a normal map (tangents are useless without it), always true for overridden materials
+	bool bHasNormalTexture = false;
 };
 
 USTRUCT(BlueprintType)
@@ -812,6 +1040,8 @@ struct FglTFRuntimeLOD
 	bool bHasNormals;
 	bool bHasTangents;
 	bool bHasUV;
+	// the runtime render data shares the primitives vertices instead of having one vertex per index
+	bool bIndexed;
 
 #if WITH_EDITOR
 	FSkeletalMeshImportData ImportData;
@@ -822,6 +1052,7 @@ struct FglTFRuntimeLOD
 		bHasNormals = false;
 		bHasTangents = false;
 		bHasUV = false;
+		bIndexed = false;
 	}
 };
 
@@ -897,6 +1128,8 @@ struct FglTFRuntimeStaticMeshContext : public FGCObject
 	FBoxSphereBounds BoundingBoxAndSphere;
 	FVector LOD0PivotDelta = FVector::ZeroVector;
 	TArray<FStaticMaterial> StaticMaterials;
+	TArray<TArray<FVector>> ConvexHulls;
+	int32 NumGeneratedLODs = 0;
 
 	FglTFRuntimeStaticMeshContext(TSharedRef<FglTFRuntimeParser> InParser, const FglTFRuntimeStaticMeshConfig& InStaticMeshConfig);
 
@@ -1082,6 +1315,230 @@ protected:
 	FArrayReader Data;
 };
 
+class FglTFRuntimeMappedFile
+{
+public:
+	~FglTFRuntimeMappedFile();
+
+	bool Map(const FString& Filename);
+
+	const uint8* GetData() const { return MappedRegion ? MappedRegion->GetMappedPtr() : nullptr; }
+	int64 Num() const { return MappedRegion ? MappedRegion->GetMappedSize() : 0; }
+
+protected:
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+};
+
+// triggered (once) when an asset built by another worker is available in its cache
+class FglTFRuntimeLoadingEvent
+{
+public:
+	FglTFRuntimeLoadingEvent();
+	~FglTFRuntimeLoadingEvent();
+
+	void Trigger();
+	void Wait();
+
+protected:
+	FEvent* Event;
+};
+
+class FglTFRuntimeStreamingFile
+{
+public:
+	bool Open(const FString& Filename);
+
+	int64 GetFileSize() const;
+
+	bool IsBinary();
+
+	bool ReadRange(const int64 Offset, const int64 Size, uint8* Destination);
+
+protected:
+	TUniquePtr<IFileHandle> FileHandle;
+	FCriticalSection ReadLock;
+};
+
+enum class EglTFRuntimeMeshoptMode : uint8
+{
+	Attributes,
+	Triangles,
+	Indices
+};
+
+enum class EglTFRuntimeMeshoptFilter : uint8
+{
+	None,
+	Octahedral,
+	Quaternion,
+	Exponential
+};
+
+struct FglTFRuntimeBufferViewDesc
+{
+	bool bValid;
+	int32 Buffer;
+	int64 ByteOffset;
+	int64 ByteLength;
+	int64 ByteStride;
+
+	// EXT_meshopt_compression, the compressed stream lives in a different buffer
+	bool bMeshopt;
+	int32 MeshoptBuffer;
+	int64 MeshoptByteOffset;
+	int64 MeshoptByteLength;
+	int64 MeshoptByteStride;
+	int64 MeshoptCount;
+	EglTFRuntimeMeshoptMode MeshoptMode;
+	EglTFRuntimeMeshoptFilter MeshoptFilter;
+
+	FglTFRuntimeBufferViewDesc()
+	{
+		bValid = false;
+		Buffer = INDEX_NONE;
+		ByteOffset = 0;
+		ByteLength = 0;
+		ByteStride = 0;
+		bMeshopt = false;
+		MeshoptBuffer = INDEX_NONE;
+		MeshoptByteOffset = 0;
+		MeshoptByteLength = 0;
+		MeshoptByteStride = 0;
+		MeshoptCount = 0;
+		MeshoptMode = EglTFRuntimeMeshoptMode::Attributes;
+		MeshoptFilter = EglTFRuntimeMeshoptFilter::None;
+	}
+};
+
+struct FglTFRuntimeAccessorDesc
+{
+	bool bValid;
+	int32 BufferView;
+	int64 ByteOffset;
+	int64 ComponentType;
+	int64 Count;
+	int64 Elements;
+	int64 ElementSize;
+	bool bNormalized;
+	bool bHasSparse;
+	int64 SparseCount;
+	int32 SparseIndicesBufferView;
+	int64 SparseIndicesByteOffset;
+	int64 SparseIndicesComponentType;
+	int32 SparseValuesBufferView;
+	int64 SparseValuesByteOffset;
+
+	FglTFRuntimeAccessorDesc()
+	{
+		bValid = false;
+		BufferView = INDEX_NONE;
+		ByteOffset = 0;
+		ComponentType = 0;
+		Count = 0;
+		Elements = 0;
+		ElementSize = 0;
+		bNormalized = false;
+		bHasSparse = false;
+		SparseCount = 0;
+		SparseIndicesBufferView = INDEX_NONE;
+		SparseIndicesByteOffset = 0;
+		SparseIndicesComponentType = 0;
+		SparseValuesBufferView = INDEX_NONE;
+		SparseValuesByteOffset = 0;
+	}
+};
+
+struct FglTFRuntimeTextureDesc
+{
+	int32 Source;
+	int32 Sampler;
+
+	FglTFRuntimeTextureDesc()
+	{
+		Source = INDEX_NONE;
+		Sampler = INDEX_NONE;
+	}
+};
+
+struct FglTFRuntimeSamplerDesc
+{
+	int32 MinFilter;
+	int32 MagFilter;
+	int32 WrapS;
+	int32 WrapT;
+
+	FglTFRuntimeSamplerDesc()
+	{
+		MinFilter = 0;
+		MagFilter = 0;
+		WrapS = 10497;
+		WrapT = 10497;
+	}
+};
+
+struct FglTFRuntimeDecodedAccessorKey
+{
+	int32 AccessorIndex;
+	int32 TypeSize;
+	int32 ComponentSize;
+	bool bNormalized;
+	bool bTransformed;
+	float Transform[18];
+
+	FglTFRuntimeDecodedAccessorKey(const int32 InAccessorIndex, const int32 InTypeSize, const int32 InComponentSize, const bool bInNormalized, const FglTFRuntimeAccessorTransform* InTransform)
+	{
+		AccessorIndex = InAccessorIndex;
+		TypeSize = InTypeSize;
+		ComponentSize = InComponentSize;
+		bNormalized = bInNormalized;
+		bTransformed = InTransform != nullptr;
+		FMemory::Memzero(Transform, sizeof(Transform));
+		if (InTransform)
+		{
+			FMemory::Memcpy(Transform, InTransform->Rows, sizeof(InTransform->Rows));
+			Transform[16] = InTransform->Scale;
+			Transform[17] = InTransform->W;
+		}
+	}
+
+	bool operator==(const FglTFRuntimeDecodedAccessorKey& Other) const
+	{
+		return AccessorIndex == Other.AccessorIndex && TypeSize == Other.TypeSize && ComponentSize == Other.ComponentSize &&
+			bNormalized == Other.bNormalized && bTransformed == Other.bTransformed && FMemory::Memcmp(Transform, Other.Transform, sizeof(Transform)) == 0;
+	}
+
+	friend uint32 GetTypeHash(const FglTFRuntimeDecodedAccessorKey& Key)
+	{
+		uint32 Hash = HashCombine(GetTypeHash(Key.AccessorIndex), GetTypeHash(Key.TypeSize));
+		Hash = HashCombine(Hash, GetTypeHash(Key.ComponentSize));
+		Hash = HashCombine(Hash, GetTypeHash(Key.bNormalized));
+		return Key.bTransformed ? HashCombine(Hash, FCrc::MemCrc32(Key.Transform, sizeof(Key.Transform))) : Hash;
+	}
+};
+
+struct FglTFRuntimeDecodedAccessor
+{
+	int64 ComponentType;
+	int64 Elements;
+	TArray<uint8> Data;
+};
+
+struct FglTFRuntimeBlob
+{
+	uint8* Data;
+	int64 Num;
+
+	// set when Data is owned by a (streamed) cache entry that can be evicted while the blob is still in use
+	TSharedPtr<TArray64<uint8>, ESPMode::ThreadSafe> Owner;
+
+	FglTFRuntimeBlob()
+	{
+		Data = nullptr;
+		Num = 0;
+	}
+};
+
 USTRUCT(BlueprintType)
 struct FglTFRuntimeAudioEmitter
 {
@@ -1112,12 +1569,16 @@ DECLARE_DYNAMIC_DELEGATE_OneParam(FglTFRuntimeSkeletalMeshAsync, USkeletalMesh*,
 class GLTFRUNTIME_API FglTFRuntimeParser : public FGCObject, public TSharedFromThis<FglTFRuntimeParser>
 {
 public:
-	FglTFRuntimeParser(TSharedRef<FJsonObject> JsonObject, const FMatrix& InSceneBasis, float InSceneScale);
+	FglTFRuntimeParser(TSharedRef<FJsonObject> JsonObject, const FMatrix& InSceneBasis, float InSceneScale, const bool bInMetadataOnly = false);
 
 	static TSharedPtr<FglTFRuntimeParser> FromFilename(const FString& Filename, const FglTFRuntimeConfig& LoaderConfig);
-	static TSharedPtr<FglTFRuntimeParser> FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile = nullptr);
+	static TSharedPtr<FglTFRuntimeParser> FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile = nullptr, TSharedPtr<FglTFRuntimeMappedFile> InMappedFile = nullptr);
 	static TSharedPtr<FglTFRuntimeParser> FromString(const FString& JsonData, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile = nullptr);
-	static TSharedPtr<FglTFRuntimeParser> FromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig);
+	static TSharedPtr<FglTFRuntimeParser> FromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeMappedFile> InMappedFile = nullptr);
+	static TSharedPtr<FglTFRuntimeParser> FromUTF8Json(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile = nullptr);
+	// json DOM built directly from UTF-8 bytes (used by FromUTF8Json), ErrorOffset is where malformed documents have been rejected
+	static TSharedPtr<FJsonValue> ParseUTF8Json(const uint8* DataPtr, int64 DataNum, int64& ErrorOffset);
+	static TSharedPtr<FglTFRuntimeParser> FromStreamingFile(TSharedRef<FglTFRuntimeStreamingFile> InStreamingFile, const FglTFRuntimeConfig& LoaderConfig);
 
 	static FORCEINLINE TSharedPtr<FglTFRuntimeParser> FromBinary(const TArray<uint8> Data, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile = nullptr) { return FromBinary(Data.GetData(), Data.Num(), LoaderConfig, InZipFile); }
 	static FORCEINLINE TSharedPtr<FglTFRuntimeParser> FromBinary(const TArray64<uint8> Data, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile = nullptr) { return FromBinary(Data.GetData(), Data.Num(), LoaderConfig, InZipFile); }
@@ -1167,9 +1628,16 @@ public:
 	bool GetBufferView(int32 BufferViewIndex, TArray64<uint8>& Bytes, int64& Stride);
 	bool GetAccessor(int32 AccessorIndex, int64& ComponentType, int64& Stride, int64& Elements, int64& ElementSize, int64& Count, bool& bNormalized, TArray64<uint8>& Bytes);
 
+	// zero-copy variants, the returned blobs point to the parser-owned memory (or to AdditionalBufferView for sparse/zero-initialized accessors)
+	bool GetBuffer(int32 BufferIndex, FglTFRuntimeBlob& Blob);
+	bool GetBufferView(int32 BufferViewIndex, FglTFRuntimeBlob& Blob, int64& Stride);
+	bool DecodeMeshoptBufferView(int32 BufferViewIndex, FglTFRuntimeBlob& Blob);
+	bool GetAccessor(int32 AccessorIndex, int64& ComponentType, int64& Stride, int64& Elements, int64& ElementSize, int64& Count, bool& bNormalized, FglTFRuntimeBlob& Blob, TArray64<uint8>& AdditionalBufferView);
+
 	bool GetAllNodes(TArray<FglTFRuntimeNode>& Nodes);
 
 	TArray<FString> GetCamerasNames();
+	TArray<FString> GetAnimationsNames();
 
 	bool LoadCameraIntoCameraComponent(const int32 CameraIndex, UCameraComponent* CameraComponent);
 
@@ -1189,6 +1657,12 @@ public:
 
 	bool LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject, TArray<FglTFRuntimePrimitive>& Primitives, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
 	bool LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObject, FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
+	bool WeldPrimitive(FglTFRuntimePrimitive& Primitive, const float PositionEpsilon, const float NormalEpsilon, const float UVEpsilon);
+	bool SimplifyPrimitive(const FglTFRuntimePrimitive& Primitive, const float TriangleRatio, FglTFRuntimePrimitive& SimplifiedPrimitive);
+	bool OptimizePrimitive(FglTFRuntimePrimitive& Primitive, const bool bVertexCache, const bool bOverdraw, const float OverdrawThreshold, const bool bVertexFetch);
+	bool GenerateSmoothNormals(FglTFRuntimePrimitive& Primitive, const float CreaseAngle, const bool bReverseWinding);
+	bool GenerateTangents(FglTFRuntimePrimitive& Primitive, const bool bOrthogonalOnly);
+	static void DecomposeConvex(const TArray<FVector>& Positions, const TArray<uint32>& Indices, const int32 MaxHulls, const int32 MaxHullVertices, const float MaxConcavity, const int32 SplitPlanes, TArray<TArray<FVector>>& Hulls);
 
 	void AddError(const FString& ErrorContext, const FString& ErrorMessage);
 	void ClearErrors();
@@ -1200,6 +1674,7 @@ public:
 
 	FglTFRuntimeError OnError;
 	FglTFRuntimeOnStaticMeshCreated OnStaticMeshCreated;
+	FglTFRuntimeOnStaticMeshCreated OnStaticMeshPhysicsCooked;
 	FglTFRuntimeOnSkeletalMeshCreated OnSkeletalMeshCreated;
 
 	void SetBinaryBuffer(const TArray64<uint8>& InBinaryBuffer)
@@ -1231,6 +1706,9 @@ public:
 	UTexture2D* BuildTexture(UObject* Outer, const TArray<FglTFRuntimeMipMap>& Mips, const FglTFRuntimeImagesConfig& ImagesConfig, const FglTFRuntimeTextureSampler& Sampler);
 
 protected:
+	static TSharedPtr<FglTFRuntimeParser> FromJsonObject(TSharedRef<FJsonObject> JsonObject, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile);
+	static TSharedPtr<FglTFRuntimeParser> FromJsonBytes(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeZipFile> InZipFile);
+
 	TSharedRef<FJsonObject> Root;
 
 	TMap<int32, UStaticMesh*> StaticMeshesCache;
@@ -1240,14 +1718,65 @@ protected:
 	TMap<int32, UTexture2D*> TexturesCache;
 
 	TMap<int32, TArray64<uint8>> BuffersCache;
+	// multiple async loads can request the same buffer at the same time
+	FCriticalSection BuffersCacheLock;
 
 	TMap<UMaterialInterface*, FString> MaterialsNameCache;
 
+	// materials, textures and skeletons caches are shared by concurrent async loads
+	FCriticalSection MaterialsCacheLock;
+	// materials being loaded by a worker, other workers wait for their event instead of building them again
+	TMap<int32, TSharedPtr<FglTFRuntimeLoadingEvent, ESPMode::ThreadSafe>> MaterialsLoading;
+	FCriticalSection TexturesCacheLock;
+	FCriticalSection SkeletonsCacheLock;
+
 	TArray<FglTFRuntimeNode> AllNodesCache;
 	bool bAllNodesCached;
+	FCriticalSection NodesCacheLock;
 
 	TArray64<uint8> BinaryBuffer;
 
+	// when set, the GLB binary chunk is a view over a memory mapped file
+	TSharedPtr<FglTFRuntimeMappedFile> MappedFile;
+	FglTFRuntimeBlob MappedBinaryBuffer;
+
+	// when set, the GLB binary chunk is read on demand, one bufferView at a time
+	TSharedPtr<FglTFRuntimeStreamingFile> StreamingFile;
+	int64 StreamingBinaryChunkOffset;
+	int64 StreamingBinaryChunkLength;
+	TMap<int32, TSharedPtr<TArray64<uint8>, ESPMode::ThreadSafe>> StreamedBufferViewsCache;
+	TArray<int32> StreamedBufferViewsLRU;
+	int64 StreamedBufferViewsCacheSize;
+	int64 StreamedBufferViewsCacheMaxSize;
+	FCriticalSection StreamingLock;
+
+	// decoded accessors are cached the second time they are requested (most accessors are used only once)
+	TMap<FglTFRuntimeDecodedAccessorKey, FglTFRuntimeDecodedAccessor> DecodedAccessorsCache;
+	// accessors requested once, keys leave the set when promoted (or rejected) and are not tracked anymore once the cache is full
+	TSet<FglTFRuntimeDecodedAccessorKey> DecodedAccessorsRequests;
+	int64 DecodedAccessorsCacheSize;
+	int64 DecodedAccessorsCacheMaxSize;
+	FCriticalSection DecodedAccessorsCacheLock;
+
+	// decoded EXT_meshopt_compression bufferViews, evicted entries stay alive until the last blob referencing them is released
+	TMap<int32, TSharedPtr<TArray64<uint8>, ESPMode::ThreadSafe>> DecodedBufferViewsCache;
+	TArray<int32> DecodedBufferViewsLRU;
+	int64 DecodedBufferViewsCacheSize;
+	int64 DecodedBufferViewsCacheMaxSize;
+	FCriticalSection DecodedBufferViewsCacheLock;
+
+	bool bMetadataOnly;
+
+	void LoadBaseMaterials();
+
+	// typed, pre-indexed copy of the hot root arrays (the json DOM is still available for extras and custom paths)
+	TArray<FglTFRuntimeBufferViewDesc> BufferViewDescs;
+	TArray<FglTFRuntimeAccessorDesc> AccessorDescs;
+	TArray<FglTFRuntimeTextureDesc> TextureDescs;
+	TArray<FglTFRuntimeSamplerDesc> SamplerDescs;
+
+	void BuildDocument();
+
 	UStaticMesh* LoadStaticMesh_Internal(TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext, TArray<TSharedRef<FJsonObject>> JsonMeshObjects, const TMap<TSharedRef<FJsonObject>, TArray<FglTFRuntimePrimitive>>& PrimitivesCache);
 	UMaterialInterface* LoadMaterial_Internal(const int32 Index, const FString& MaterialName, TSharedRef<FJsonObject> JsonMaterialObject, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const bool bUseVertexColors);
 	bool LoadNode_Internal(int32 Index, TSharedRef<FJsonObject> JsonNodeObject, int32 NodesCount, FglTFRuntimeNode& Node);
@@ -1314,20 +1843,48 @@ protected:
 	TMap<EglTFRuntimeMaterialType, UMaterialInterface*> SpecularGlossinessMaterialsMap;
 
 	TArray<FString> Errors;
+	FCriticalSection ErrorsLock;
 
 	FString BaseDirectory;
 
-	template<typename T, typename Callback>
-	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedElements, const TArray<int64>& SupportedTypes, bool bNormalized, Callback Filter)
+	template<typename T>
+	bool BuildTransformedFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedElements, const TArray<int64>& SupportedTypes, bool bNormalized, const FglTFRuntimeAccessorTransform* Transform)
 	{
 		int64 AccessorIndex;
 		if (!JsonObject->TryGetNumberField(Name, AccessorIndex))
 			return false;
 
-		TArray64<uint8> Bytes;
+		const FglTFRuntimeDecodedAccessorKey CacheKey(AccessorIndex, sizeof(T), sizeof(typename TglTFRuntimeAccessorStore<T>::ComponentType), bNormalized, Transform);
+		bool bCacheable = false;
+		if (DecodedAccessorsCacheMaxSize > 0)
+		{
+			FScopeLock Lock(&DecodedAccessorsCacheLock);
+			if (const FglTFRuntimeDecodedAccessor* DecodedAccessor = DecodedAccessorsCache.Find(CacheKey))
+			{
+				if (!SupportedElements.Contains(DecodedAccessor->Elements) || !SupportedTypes.Contains(DecodedAccessor->ComponentType))
+				{
+					return false;
+				}
+				const int32 Offset = Data.Num();
+				Data.AddUninitialized(DecodedAccessor->Data.Num() / sizeof(T));
+				FMemory::Memcpy(Data.GetData() + Offset, DecodedAccessor->Data.GetData(), DecodedAccessor->Data.Num());
+				return true;
+			}
+
+			// a full cache (it never evicts) cannot take new accessors, so there is no point in tracking them
+			if (DecodedAccessorsCacheSize < DecodedAccessorsCacheMaxSize)
+			{
+				bool bAlreadyRequested = false;
+				DecodedAccessorsRequests.Add(CacheKey, &bAlreadyRequested);
+				bCacheable = bAlreadyRequested;
+			}
+		}
+
+		FglTFRuntimeBlob Blob;
+		TArray64<uint8> AdditionalBufferView;
 		int64 ComponentType = 0, Stride = 0, Elements = 0, ElementSize = 0, Count = 0;
 		bool bOverrideNormalized = false;
-		if (!GetAccessor(AccessorIndex, ComponentType, Stride, Elements, ElementSize, Count, bOverrideNormalized, Bytes))
+		if (!GetAccessor(AccessorIndex, ComponentType, Stride, Elements, ElementSize, Count, bOverrideNormalized, Blob, AdditionalBufferView))
 		{
 			return false;
 		}
@@ -1347,147 +1904,57 @@ protected:
 			return false;
 		}
 
-		for (int64 ElementIndex = 0; ElementIndex < Count; ElementIndex++)
+		const int32 Offset = Data.Num();
+		Data.AddUninitialized(Count);
+		if (!FglTFRuntimeAccessorKernels::Decode(ComponentType, bNormalized, Elements, Blob.Data, Stride, Count, Data.GetData() + Offset, Transform))
 		{
-			int64 Index = ElementIndex * Stride;
-			T Value;
-			// FLOAT
-			if (ComponentType == 5126)
-			{
-				float* Ptr = (float*)&(Bytes[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = Ptr[i];
-				}
-			}
-			// BYTE
-			else if (ComponentType == 5120)
-			{
-				int8* Ptr = (int8*)&(Bytes[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? FMath::Max(((float)Ptr[i]) / 127.f, -1.f) : Ptr[i];
-				}
+			Data.SetNum(Offset);
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
+			return false;
+		}
 
-			}
-			// UNSIGNED_BYTE
-			else if (ComponentType == 5121)
-			{
-				uint8* Ptr = (uint8*)&(Bytes[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? ((float)Ptr[i]) / 255.f : Ptr[i];
-				}
-			}
-			// SHORT
-			else if (ComponentType == 5122)
-			{
-				int16* Ptr = (int16*)&(Bytes[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? FMath::Max(((float)Ptr[i]) / 32767.f, -1.f) : Ptr[i];
-				}
-			}
-			// UNSIGNED_SHORT
-			else if (ComponentType == 5123)
+		if (bCacheable)
+		{
+			const int64 DecodedSize = Count * sizeof(T);
+			FScopeLock Lock(&DecodedAccessorsCacheLock);
+			// the request is settled either way: promoted now or too big for the remaining budget
+			DecodedAccessorsRequests.Remove(CacheKey);
+			if (DecodedAccessorsCacheSize + DecodedSize <= DecodedAccessorsCacheMaxSize && !DecodedAccessorsCache.Contains(CacheKey))
 			{
-				uint16* Ptr = (uint16*)&(Bytes[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? ((float)Ptr[i]) / 65535.f : Ptr[i];
-				}
+				FglTFRuntimeDecodedAccessor& DecodedAccessor = DecodedAccessorsCache.Add(CacheKey);
+				DecodedAccessor.ComponentType = ComponentType;
+				DecodedAccessor.Elements = Elements;
+				DecodedAccessor.Data.Append(reinterpret_cast<const uint8*>(Data.GetData() + Offset), DecodedSize);
+				DecodedAccessorsCacheSize += DecodedSize;
 			}
-			else
-			{
-				UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
-				return false;
-			}
-
-			Data.Add(Filter(Value));
 		}
 
 		return true;
 	}
 
 	template<typename T, typename Callback>
-	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedTypes, bool bNormalized, Callback Filter)
+	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedElements, const TArray<int64>& SupportedTypes, bool bNormalized, Callback Filter)
 	{
-		int64 AccessorIndex;
-		if (!JsonObject->TryGetNumberField(Name, AccessorIndex))
-		{
-			return false;
-		}
-
-		TArray64<uint8> Bytes;
-		int64 ComponentType, Stride, Elements, ElementSize, Count;
-		bool bOverrideNormalized = false;
-		if (!GetAccessor(AccessorIndex, ComponentType, Stride, Elements, ElementSize, Count, bOverrideNormalized, Bytes))
-		{
-			return false;
-		}
-
-		if (bOverrideNormalized)
-		{
-			bNormalized = bOverrideNormalized;
-		}
-
-		if (Elements != 1)
+		const int32 Offset = Data.Num();
+		if (!BuildTransformedFromAccessorField(JsonObject, Name, Data, SupportedElements, SupportedTypes, bNormalized, nullptr))
 		{
 			return false;
 		}
 
-		if (!SupportedTypes.Contains(ComponentType))
+		for (int32 ElementIndex = Offset; ElementIndex < Data.Num(); ElementIndex++)
 		{
-			return false;
-		}
-
-		for (int64 ElementIndex = 0; ElementIndex < Count; ElementIndex++)
-		{
-			int64 Index = ElementIndex * Stride;
-			T Value;
-			// FLOAT
-			if (ComponentType == 5126)
-			{
-				float* Ptr = (float*)&(Bytes[Index]);
-				Value = *Ptr;
-			}
-			// BYTE
-			else if (ComponentType == 5120)
-			{
-				int8* Ptr = (int8*)&(Bytes[Index]);
-				Value = bNormalized ? FMath::Max(((float)(*Ptr)) / 127.f, -1.f) : *Ptr;
-
-			}
-			// UNSIGNED_BYTE
-			else if (ComponentType == 5121)
-			{
-				uint8* Ptr = (uint8*)&(Bytes[Index]);
-				Value = bNormalized ? ((float)(*Ptr)) / 255.f : *Ptr;
-			}
-			// SHORT
-			else if (ComponentType == 5122)
-			{
-				int16* Ptr = (int16*)&(Bytes[Index]);
-				Value = bNormalized ? FMath::Max(((float)(*Ptr)) / 32767.f, -1.f) : *Ptr;
-			}
-			// UNSIGNED_SHORT
-			else if (ComponentType == 5123)
-			{
-				uint16* Ptr = (uint16*)&(Bytes[Index]);
-				Value = bNormalized ? ((float)(*Ptr)) / 65535.f : *Ptr;
-			}
-			else
-			{
-				UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
-				return false;
-			}
-
-			Data.Add(Filter(Value));
+			Data[ElementIndex] = Filter(Data[ElementIndex]);
 		}
 
 		return true;
 	}
 
+	template<typename T, typename Callback>
+	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedTypes, bool bNormalized, Callback Filter)
+	{
+		return BuildFromAccessorField(JsonObject, Name, Data, { 1 }, SupportedTypes, bNormalized, Filter);
+	}
+
 	template<typename T>
 	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedElements, const TArray<int64>& SupportedTypes, const bool bNormalized)
 	{
@@ -0,0 +1,34 @@
+// Copyright 2020-2022, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// declared (as an UENUM) in glTFRuntimeParser.h, so it can be set in the mesh configs
+enum class EglTFRuntimeTaskPriority : uint8;
+
+/*
+ * Bounded worker pool shared by all of the glTFRuntime async loaders.
+ * The number of workers is read from the glTFRuntime.AsyncMaxThreads console variable when the pool is created.
+ *
+ * Game thread work requested by the workers (mesh finalization, materials and textures) is queued
+ * and drained by a ticker, spending at most glTFRuntime.GameThreadBudgetMs per frame.
+ */
+class GLTFRUNTIME_API FglTFRuntimeTaskScheduler
+{
+public:
+	static void Dispatch(TUniqueFunction<void()>&& Task, const EglTFRuntimeTaskPriority Priority);
+
+	// runs the task on the game thread (immediately if already there) and waits for its completion
+	static void RunOnGameThread(TUniqueFunction<void()>&& Task);
+
+	// tasks waiting for a worker
+	static int32 GetQueuedTasks();
+	// tasks currently running on a worker
+	static int32 GetRunningTasks();
+	// game thread tasks waiting for the next frame
+	static int32 GetQueuedGameThreadTasks();
+
+	static void Startup();
+	static void Shutdown();
+};